@@ -0,0 +1,153 @@
+/**
+ *  @file   benchmarks/KDTreeBenchmark.cc
+ *
+ *  @brief  Micro-benchmark comparing the KDTreeLinkerAlgo and FlatKDTreeLinkerAlgo kd tree layouts for 2D hit views
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArUtility/FlatKDTreeLinkerAlgoT.h"
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace lar_content;
+
+namespace
+{
+
+typedef KDTreeNodeInfoT<unsigned int, 2> BenchmarkNode;
+typedef std::vector<BenchmarkNode> BenchmarkNodeList;
+
+/**
+ *  @brief  Generate a single view of hits, uniform in x and z, with a third of the hits on a grid matching a 0.3 cm wire pitch
+ *
+ *  @param  nHits the number of hits
+ *  @param  seed the random number seed
+ *  @param  nodes to receive the hit nodes
+ *  @param  region to receive the bounding region of the hits
+ */
+void GenerateView(const unsigned int nHits, const unsigned int seed, BenchmarkNodeList &nodes, KDTreeBox &region)
+{
+    // Keep the hit density close to that of a busy view, whatever the number of hits
+    const float viewSize(10.f * std::sqrt(static_cast<float>(nHits)));
+    const float wirePitch(0.3f);
+
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> uniform(0.f, viewSize);
+
+    nodes.clear();
+    nodes.reserve(nHits);
+
+    for (unsigned int iHit = 0; iHit < nHits; ++iHit)
+    {
+        const float x(uniform(generator));
+        float z(uniform(generator));
+
+        if (0 == iHit % 3)
+            z = wirePitch * std::round(z / wirePitch);
+
+        nodes.emplace_back(iHit, x, z);
+    }
+
+    region = KDTreeBox(0.f, viewSize, 0.f, viewSize);
+}
+
+/**
+ *  @brief  Time a function call
+ *
+ *  @param  function the function to call
+ *
+ *  @return the elapsed time, in milliseconds
+ */
+template <typename FUNCTION>
+double TimeIt(const FUNCTION &function)
+{
+    const auto start(std::chrono::steady_clock::now());
+    function();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ *  @brief  Build a kd tree and run the box and radius queries, printing the timings and the total number of points found
+ *
+ *  @param  name the name of the kd tree layout
+ *  @param  nodes the hit nodes
+ *  @param  region the bounding region of the hits
+ *  @param  queryNodes the query points
+ *  @param  halfWidth the box search half width, also used as the radius search radius
+ */
+template <typename TREE>
+void RunBenchmark(const std::string &name, const BenchmarkNodeList &nodes, const KDTreeBox &region, const BenchmarkNodeList &queryNodes,
+    const float halfWidth)
+{
+    BenchmarkNodeList buildNodes(nodes);
+    TREE kdTree;
+    const double buildTime(TimeIt([&]() { kdTree.build(buildNodes, region); }));
+
+    BenchmarkNodeList found;
+    unsigned long nBoxFound(0), nRadiusFound(0);
+
+    const double boxTime(TimeIt([&]() {
+        for (const BenchmarkNode &queryNode : queryNodes)
+        {
+            const KDTreeBox searchBox(queryNode.dims[0] - halfWidth, queryNode.dims[0] + halfWidth, queryNode.dims[1] - halfWidth,
+                queryNode.dims[1] + halfWidth);
+            found.clear();
+            kdTree.search(searchBox, found);
+            nBoxFound += found.size();
+        }
+    }));
+
+    const double radiusTime(TimeIt([&]() {
+        for (const BenchmarkNode &queryNode : queryNodes)
+        {
+            found.clear();
+            kdTree.searchRadius(queryNode, halfWidth, found);
+            nRadiusFound += found.size();
+        }
+    }));
+
+    std::cout << "  " << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(1) << " build "
+              << std::setw(8) << buildTime << " ms, box " << std::setw(8) << boxTime << " ms (" << nBoxFound << " found), radius "
+              << std::setw(8) << radiusTime << " ms (" << nRadiusFound << " found)" << std::endl;
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const unsigned int nQueries((argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 100000);
+    const float halfWidth(2.f);
+
+    std::cout << "KDTreeBenchmark: " << nQueries << " queries per view, box half width and radius " << halfWidth << " cm" << std::endl;
+
+    for (const unsigned int nHits : {10000, 100000, 1000000})
+    {
+        BenchmarkNodeList nodes;
+        KDTreeBox region;
+        GenerateView(nHits, nHits, nodes, region);
+
+        // Centre the queries on hits, as the reconstruction does
+        BenchmarkNodeList queryNodes;
+        queryNodes.reserve(nQueries);
+
+        for (unsigned int iQuery = 0; iQuery < nQueries; ++iQuery)
+            queryNodes.push_back(nodes.at((7919UL * iQuery) % nHits));
+
+        std::cout << nHits << " hits" << std::endl;
+        RunBenchmark<KDTreeLinkerAlgo<unsigned int, 2>>("KDTreeLinkerAlgo", nodes, region, queryNodes, halfWidth);
+        RunBenchmark<FlatKDTreeLinkerAlgo<unsigned int, 2>>("FlatKDTreeLinkerAlgo", nodes, region, queryNodes, halfWidth);
+    }
+
+    return 0;
+}
@@ -13,6 +13,7 @@
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
 
 #include "larpandoracontent/LArObjects/LArAdaBoostDecisionTree.h"
+#include "larpandoracontent/LArObjects/LArMvaTrainingWriter.h"
 
 namespace lar_content
 {
@@ -392,6 +393,8 @@ private:
     float m_minPurity;                ///< Minimum purity of the best slice to use event for training
     float m_minCompleteness;          ///< Minimum completeness of the best slice to use event for training
 
+    std::unique_ptr<MvaTrainingWriter> m_pTrainingWriter; ///< The writer for training examples, keeping the output file open
+
     // Classification
     AdaBoostDecisionTree m_adaBoostDecisionTree;     ///< The adaptive boost decision tree
     std::string m_filePathEnvironmentVariable;       ///< The environment variable providing a list of paths to bdt files
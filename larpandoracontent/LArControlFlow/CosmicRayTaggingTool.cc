@@ -15,6 +15,12 @@
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+#include "larpandoracontent/LArUtility/KDTreeLinkerToolsT.h"
+
+#include <cmath>
+#include <numeric>
+
 using namespace pandora;
 
 namespace lar_content
@@ -26,6 +32,8 @@ CosmicRayTaggingTool::CosmicRayTaggingTool() :
     m_positionalUncertainty(3.f),
     m_maxAssociationDist(3.f * 18.f),
     m_minimumHits(15),
+    m_positionFitHalfWindow(5),
+    m_directionFitHalfWindow(100),
     m_inTimeMargin(5.f),
     m_inTimeMaxX0(1.f),
     m_marginY(20.f),
@@ -161,6 +169,7 @@ void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos
     const float layerPitch(pFirstLArTPC->GetWirePitchW());
 
     PfoToSlidingFitsMap pfoToSlidingFitsMap;
+    PfoVector fittedPfos;
 
     for (const ParticleFlowObject *const pPfo : parentCosmicRayPfos)
     {
@@ -168,28 +177,86 @@ void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos
         if (!this->GetValid3DCluster(pPfo, pCluster) || !pCluster)
             continue;
 
-        (void)pfoToSlidingFitsMap.insert(PfoToSlidingFitsMap::value_type(pPfo,
-            std::make_pair(ThreeDSlidingFitResult(pCluster, 5, layerPitch), ThreeDSlidingFitResult(pCluster, 100, layerPitch)))); // TODO Configurable
+        if (pfoToSlidingFitsMap.insert(PfoToSlidingFitsMap::value_type(pPfo,
+                std::make_pair(ThreeDSlidingFitResult(pCluster, m_positionFitHalfWindow, layerPitch),
+                    ThreeDSlidingFitResult(pCluster, m_directionFitHalfWindow, layerPitch)))).second)
+        {
+            fittedPfos.push_back(pPfo);
+        }
     }
 
-    for (const ParticleFlowObject *const pPfo1 : parentCosmicRayPfos)
+    // Index the fitted endpoints, so that only Pfos with an endpoint within the maximum association separation are checked
+    const float maxEndpointSeparation(this->GetMaxEndpointSeparation());
+    const bool useKDTree(maxEndpointSeparation < std::numeric_limits<float>::max());
+
+    PointList endpoints;
+    PointToPfoIndexMap pointToPfoIndexMap;
+    std::vector<bool> isIndexed(fittedPfos.size(), false);
+    std::vector<unsigned int> unindexedPfoIndices;
+
+    for (unsigned int pfoIndex = 0; pfoIndex < fittedPfos.size(); ++pfoIndex)
     {
-        PfoToSlidingFitsMap::const_iterator iter1(pfoToSlidingFitsMap.find(pPfo1));
-        if (pfoToSlidingFitsMap.end() == iter1)
+        const ThreeDSlidingFitResult &fitPos(pfoToSlidingFitsMap.at(fittedPfos.at(pfoIndex)).first);
+
+        // ATTN Pfos with non-finite endpoints cannot be indexed, so are always checked
+        if (!useKDTree || !std::isfinite(fitPos.GetGlobalMinLayerPosition().GetMagnitudeSquared()) ||
+            !std::isfinite(fitPos.GetGlobalMaxLayerPosition().GetMagnitudeSquared()))
+        {
+            unindexedPfoIndices.push_back(pfoIndex);
             continue;
+        }
 
-        const ThreeDSlidingFitResult &fitPos1(iter1->second.first), &fitDir1(iter1->second.second);
+        isIndexed.at(pfoIndex) = true;
 
-        for (const ParticleFlowObject *const pPfo2 : parentCosmicRayPfos)
+        for (const CartesianVector *const pEndpoint : {&fitPos.GetGlobalMinLayerPosition(), &fitPos.GetGlobalMaxLayerPosition()})
         {
-            if (pPfo1 == pPfo2)
-                continue;
+            endpoints.push_back(pEndpoint);
+            (void)pointToPfoIndexMap.insert(PointToPfoIndexMap::value_type(pEndpoint, pfoIndex));
+        }
+    }
+
+    PointKDNode3DList kDNode3DList;
+    KDTreeCube boundingRegion3D(fill_and_bound_3d_kd_tree(endpoints, kDNode3DList));
+
+    PointKDTree3D kdTree;
+    kdTree.build(kDNode3DList, boundingRegion3D);
+
+    std::vector<unsigned int> allPfoIndices(fittedPfos.size());
+    std::iota(allPfoIndices.begin(), allPfoIndices.end(), 0);
+
+    std::unordered_map<const ParticleFlowObject *, PfoSet> associatedPfos;
 
-            PfoToSlidingFitsMap::const_iterator iter2(pfoToSlidingFitsMap.find(pPfo2));
-            if (pfoToSlidingFitsMap.end() == iter2)
+    for (unsigned int pfoIndex1 = 0; pfoIndex1 < fittedPfos.size(); ++pfoIndex1)
+    {
+        const ParticleFlowObject *const pPfo1(fittedPfos.at(pfoIndex1));
+        const ThreeDSlidingFitResult &fitPos1(pfoToSlidingFitsMap.at(pPfo1).first), &fitDir1(pfoToSlidingFitsMap.at(pPfo1).second);
+
+        // Check the candidates in the order of the input list
+        std::vector<unsigned int> candidateIndices(isIndexed.at(pfoIndex1) ? unindexedPfoIndices : allPfoIndices);
+
+        if (isIndexed.at(pfoIndex1))
+        {
+            for (const CartesianVector *const pEndpoint : {&fitPos1.GetGlobalMinLayerPosition(), &fitPos1.GetGlobalMaxLayerPosition()})
+            {
+                PointKDNode3DList found;
+                kdTree.search(build_3d_kd_search_region(*pEndpoint, maxEndpointSeparation, maxEndpointSeparation, maxEndpointSeparation), found);
+
+                for (const PointKDNode3D &node : found)
+                    candidateIndices.push_back(pointToPfoIndexMap.at(node.data));
+            }
+
+            std::sort(candidateIndices.begin(), candidateIndices.end());
+            candidateIndices.erase(std::unique(candidateIndices.begin(), candidateIndices.end()), candidateIndices.end());
+        }
+
+        for (const unsigned int pfoIndex2 : candidateIndices)
+        {
+            const ParticleFlowObject *const pPfo2(fittedPfos.at(pfoIndex2));
+
+            if (pPfo1 == pPfo2)
                 continue;
 
-            const ThreeDSlidingFitResult &fitPos2(iter2->second.first), &fitDir2(iter2->second.second);
+            const ThreeDSlidingFitResult &fitPos2(pfoToSlidingFitsMap.at(pPfo2).first), &fitDir2(pfoToSlidingFitsMap.at(pPfo2).second);
 
             // TODO Use existing LArPointingClusters and IsEmission/IsNode logic, for consistency
             if (!(this->CheckAssociation(fitPos1.GetGlobalMinLayerPosition(), fitDir1.GetGlobalMinLayerDirection() * -1.f,
@@ -206,10 +273,10 @@ void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos
 
             PfoList &pfoList1(pfoAssociationMap[pPfo1]), &pfoList2(pfoAssociationMap[pPfo2]);
 
-            if (pfoList1.end() == std::find(pfoList1.begin(), pfoList1.end(), pPfo2))
+            if (associatedPfos[pPfo1].insert(pPfo2).second)
                 pfoList1.push_back(pPfo2);
 
-            if (pfoList2.end() == std::find(pfoList2.begin(), pfoList2.end(), pPfo1))
+            if (associatedPfos[pPfo2].insert(pPfo1).second)
                 pfoList2.push_back(pPfo1);
         }
     }
@@ -217,6 +284,22 @@ void CosmicRayTaggingTool::GetPfoAssociations(const PfoList &parentCosmicRayPfos
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float CosmicRayTaggingTool::GetMaxEndpointSeparation() const
+{
+    // Associated endpoints are separated by at most |lambda| + |mu| + |d|, each bounded by the limits applied in CheckAssociation
+    const float deltaTheta(m_angularUncertainty * M_PI / 180.f);
+    const float maxVertexUncertainty(m_maxAssociationDist * std::sin(deltaTheta) + m_positionalUncertainty);
+    const float maxClosestApproachDist(std::fabs(m_maxAssociationDist) + std::fabs(maxVertexUncertainty));
+    const float maxSeparation(2.f * (1.f + std::fabs(std::sin(deltaTheta))) * maxClosestApproachDist + std::fabs(m_positionalUncertainty));
+
+    // ATTN Generous margin to absorb rounding in the association check
+    const float maxEndpointSeparation(1.01f * maxSeparation + 1.f);
+
+    return (std::isfinite(maxEndpointSeparation) ? maxEndpointSeparation : std::numeric_limits<float>::max());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool CosmicRayTaggingTool::CheckAssociation(
     const CartesianVector &endPoint1, const CartesianVector &endDir1, const CartesianVector &endPoint2, const CartesianVector &endDir2) const
 {
@@ -594,6 +677,12 @@ StatusCode CosmicRayTaggingTool::ReadSettings(const TiXmlHandle xmlHandle)
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "HitThreshold", m_minimumHits));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "PositionFitHalfWindow", m_positionFitHalfWindow));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "DirectionFitHalfWindow", m_directionFitHalfWindow));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "InTimeMargin", m_inTimeMargin));
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "InTimeMaxX0", m_inTimeMaxX0));
@@ -12,11 +12,20 @@
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
+#include <list>
 #include <unordered_map>
+#include <vector>
 
 namespace lar_content
 {
 
+template <typename, unsigned int>
+class KDTreeLinkerAlgo;
+template <typename, unsigned int>
+class KDTreeNodeInfoT;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  CosmicRayTaggingTool class
  */
@@ -87,6 +96,13 @@ private:
      */
     void GetPfoAssociations(const pandora::PfoList &parentCosmicRayPfos, PfoToPfoListMap &pfoAssociationMap) const;
 
+    /**
+     *  @brief  Get a conservative upper bound on the separation between two Pfo endpoints that can pass the association check
+     *
+     *  @return the maximum endpoint separation, or infinity if no bound can be placed
+     */
+    float GetMaxEndpointSeparation() const;
+
     /**
      *  @brief  Check whethe two Pfo endpoints are associated by distance of closest approach
      *
@@ -187,6 +203,12 @@ private:
     typedef std::unordered_map<const pandora::ParticleFlowObject *, SlidingFitPair> PfoToSlidingFitsMap;
     typedef std::vector<pandora::PfoList> SliceList;
 
+    typedef KDTreeLinkerAlgo<const pandora::CartesianVector *, 3> PointKDTree3D;
+    typedef KDTreeNodeInfoT<const pandora::CartesianVector *, 3> PointKDNode3D;
+    typedef std::vector<PointKDNode3D> PointKDNode3DList;
+    typedef std::list<const pandora::CartesianVector *> PointList;
+    typedef std::unordered_map<const pandora::CartesianVector *, unsigned int> PointToPfoIndexMap;
+
     /**
      *  @brief  Choose a set of cuts using a keyword - "cautious" = remove as few neutrinos as possible
      *          "nominal" = optimised to maximise CR removal whilst preserving neutrinos
@@ -198,7 +220,9 @@ private:
     float m_positionalUncertainty; ///< The uncertainty in cm for the position of Pfo endpoint in 3D
     float m_maxAssociationDist; ///< The maximum distance from endpoint to point of closest approach, typically a multiple of LAr radiation length
 
-    unsigned int m_minimumHits; ///< The minimum number of hits for a Pfo to be considered
+    unsigned int m_minimumHits;            ///< The minimum number of hits for a Pfo to be considered
+    unsigned int m_positionFitHalfWindow;  ///< The sliding fit half window used to find the Pfo endpoint positions
+    unsigned int m_directionFitHalfWindow; ///< The sliding fit half window used to find the Pfo endpoint directions
 
     float m_inTimeMargin; ///< The maximum distance outside of the physical detector volume that a Pfo may be to still be considered in time
     float m_inTimeMaxX0;  ///< The maximum pfo x0 (determined from shifted vertex) to allow pfo to still be considered in time
@@ -17,7 +17,9 @@
 #include "larpandoracontent/LArHelpers/LArFileHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 #include "larpandoracontent/LArHelpers/LArStitchingHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadHelper.h"
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 #include "larpandoracontent/LArObjects/LArMCParticle.h"
@@ -45,9 +47,11 @@ MasterAlgorithm::MasterAlgorithm() :
     m_printOverallRecoStatus(false),
     m_visualizeOverallRecoStatus(false),
     m_shouldRemoveOutOfTimeHits(true),
+    m_shouldRunCRWorkersInParallel(false),
+    m_nCRWorkerThreads(4),
     m_pSlicingWorkerInstance(nullptr),
-    m_pSliceNuWorkerInstance(nullptr),
-    m_pSliceCRWorkerInstance(nullptr),
+    m_nSliceWorkerInstances(1),
+    m_nSliceWorkerThreads(4),
     m_fullWidthCRWorkerWireGaps(true),
     m_passMCParticlesToWorkerInstances(false),
     m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
@@ -138,6 +142,8 @@ void MasterAlgorithm::StitchPfos(
 
         if (pParentCluster)
         {
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pParentCluster);
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pDaughterCluster);
             PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
                 PandoraContentApi::MergeAndDeleteClusters(*this, pParentCluster, pDaughterCluster, m_recreatedClusterListName, m_recreatedClusterListName));
         }
@@ -218,11 +224,16 @@ StatusCode MasterAlgorithm::InitializeWorkerInstances()
         if (m_shouldRunSlicing)
             m_pSlicingWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_slicingSettingsFile, "SlicingWorker");
 
-        if (m_shouldRunNeutrinoRecoOption)
-            m_pSliceNuWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_nuSettingsFile, "SliceNuWorker");
+        for (unsigned int iWorker = 0; iWorker < m_nSliceWorkerInstances; ++iWorker)
+        {
+            const std::string suffix(iWorker > 0 ? std::to_string(iWorker) : "");
 
-        if (m_shouldRunCosmicRecoOption)
-            m_pSliceCRWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_crSettingsFile, "SliceCRWorker");
+            if (m_shouldRunNeutrinoRecoOption)
+                m_sliceNuWorkerInstances.push_back(this->CreateWorkerInstance(larTPCMap, gapList, m_nuSettingsFile, "SliceNuWorker" + suffix));
+
+            if (m_shouldRunCosmicRecoOption)
+                m_sliceCRWorkerInstances.push_back(this->CreateWorkerInstance(larTPCMap, gapList, m_crSettingsFile, "SliceCRWorker" + suffix));
+        }
     }
     catch (const StatusCodeException &statusCodeException)
     {
@@ -244,10 +255,8 @@ StatusCode MasterAlgorithm::CopyMCParticles() const
     PandoraInstanceList pandoraWorkerInstances(m_crWorkerInstances);
     if (m_pSlicingWorkerInstance)
         pandoraWorkerInstances.push_back(m_pSlicingWorkerInstance);
-    if (m_pSliceNuWorkerInstance)
-        pandoraWorkerInstances.push_back(m_pSliceNuWorkerInstance);
-    if (m_pSliceCRWorkerInstance)
-        pandoraWorkerInstances.push_back(m_pSliceCRWorkerInstance);
+    pandoraWorkerInstances.insert(pandoraWorkerInstances.end(), m_sliceNuWorkerInstances.begin(), m_sliceNuWorkerInstances.end());
+    pandoraWorkerInstances.insert(pandoraWorkerInstances.end(), m_sliceCRWorkerInstances.begin(), m_sliceCRWorkerInstances.end());
 
     LArMCParticleFactory mcParticleFactory;
 
@@ -297,7 +306,8 @@ StatusCode MasterAlgorithm::GetVolumeIdToHitListMap(VolumeIdToHitListMap &volume
 
 StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMap &volumeIdToHitListMap) const
 {
-    unsigned int workerCounter(0);
+    typedef std::pair<const Pandora *, const CaloHitList *> WorkerHitListPair;
+    std::vector<WorkerHitListPair> workerHitListPairs;
 
     for (const Pandora *const pCRWorker : m_crWorkerInstances)
     {
@@ -307,13 +317,38 @@ StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMa
         if (volumeIdToHitListMap.end() == iter)
             continue;
 
-        for (const CaloHit *const pCaloHit : iter->second.m_allHitList)
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pCRWorker, pCaloHit));
+        workerHitListPairs.emplace_back(pCRWorker, &(iter->second.m_allHitList));
+    }
 
+    if (m_shouldRunCRWorkersInParallel)
+    {
+        if (m_printOverallRecoStatus)
+        {
+            std::cout << "Running " << workerHitListPairs.size() << " of " << m_crWorkerInstances.size()
+                      << " cosmic-ray reconstruction worker instances, using up to " << m_nCRWorkerThreads << " threads" << std::endl;
+        }
+
+        // ATTN Each worker instance owns an independent LArTPC and hit list, so only the per-worker status codes need be gathered here
+        std::vector<StatusCode> statusCodes(workerHitListPairs.size(), STATUS_CODE_SUCCESS);
+
+        LArThreadHelper::ParallelFor(workerHitListPairs.size(), m_nCRWorkerThreads, [&](const unsigned int index) {
+            statusCodes.at(index) = this->RunCosmicRayWorker(workerHitListPairs.at(index).first, *(workerHitListPairs.at(index).second));
+        });
+
+        for (const StatusCode statusCode : statusCodes)
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, statusCode);
+
+        return STATUS_CODE_SUCCESS;
+    }
+
+    unsigned int workerCounter(0);
+
+    for (const WorkerHitListPair &workerHitListPair : workerHitListPairs)
+    {
         if (m_printOverallRecoStatus)
             std::cout << "Running cosmic-ray reconstruction worker instance " << ++workerCounter << " of " << m_crWorkerInstances.size() << std::endl;
 
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pCRWorker));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunCosmicRayWorker(workerHitListPair.first, *(workerHitListPair.second)));
     }
 
     return STATUS_CODE_SUCCESS;
@@ -321,8 +356,21 @@ StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMa
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode MasterAlgorithm::RunCosmicRayWorker(const Pandora *const pCRWorker, const CaloHitList &caloHitList) const
+{
+    for (const CaloHit *const pCaloHit : caloHitList)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pCRWorker, pCaloHit));
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pCRWorker));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::RecreateCosmicRayPfos(PfoToLArTPCMap &pfoToLArTPCMap) const
 {
+    // ATTN Always recreate pfos in worker instance order, so that output is independent of whether workers were run concurrently
     for (const Pandora *const pCRWorker : m_crWorkerInstances)
     {
         const PfoList *pCRPfos(nullptr);
@@ -445,6 +493,7 @@ StatusCode MasterAlgorithm::RunCosmicRayHitRemoval(const PfoList &ambiguousPfos)
         }
 
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Delete(*this, pPfoToDelete));
+        LArSlidingFitCacheHelper::InvalidateClusters(this->GetPandora(), clusterList);
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Delete(*this, &clusterList));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Delete(*this, &vertexList));
     }
@@ -529,59 +578,85 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
         selectedSliceVector = std::move(sliceVector);
     }
 
-    unsigned int sliceCounter(0);
+    const unsigned int nSlices(selectedSliceVector.size());
+    SliceHypotheses nuSlicePfos(m_shouldRunNeutrinoRecoOption ? nSlices : 0), crSlicePfos(m_shouldRunCosmicRecoOption ? nSlices : 0);
 
-    for (const CaloHitList &sliceHits : selectedSliceVector)
+    if (m_nSliceWorkerInstances > 1)
     {
-        for (const CaloHit *const pSliceCaloHit : sliceHits)
+        if (m_printOverallRecoStatus)
         {
-            // ATTN Must ensure we copy the hit actually owned by master instance; access differs with/without slicing enabled
-            const CaloHit *const pCaloHitInMaster(m_shouldRunSlicing ? static_cast<const CaloHit *>(pSliceCaloHit->GetParentAddress()) : pSliceCaloHit);
+            std::cout << "Running " << nSlices << " slice(s) using " << m_nSliceWorkerInstances << " worker instances per hypothesis"
+                      << ", using up to " << m_nSliceWorkerThreads << " threads" << std::endl;
+        }
 
-            if (m_shouldRunNeutrinoRecoOption)
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceNuWorkerInstance, pCaloHitInMaster));
+        // ATTN Slices are assigned to worker instances round-robin, with each instance processing its slices in slice-index order.
+        // Instances are not reset between slices, as the slice pfos must survive until the best hypotheses are selected, so worker
+        // algorithms must only act upon the hits of the current slice to match the single instance output. In particular, a
+        // PreProcessingAlgorithm MaxEventHits limit must be applied per slice, using its MaxEventHitsPerSlice setting
+        typedef std::pair<const Pandora *, SliceHypotheses *> WorkerHypothesesPair;
+        std::vector<WorkerHypothesesPair> workerHypothesesPairs;
 
-            if (m_shouldRunCosmicRecoOption)
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceCRWorkerInstance, pCaloHitInMaster));
-        }
+        for (const Pandora *const pSliceNuWorker : m_sliceNuWorkerInstances)
+            workerHypothesesPairs.emplace_back(pSliceNuWorker, &nuSlicePfos);
 
-        if (m_shouldRunNeutrinoRecoOption)
-        {
-            if (m_printOverallRecoStatus)
-                std::cout << "Running nu worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
+        for (const Pandora *const pSliceCRWorker : m_sliceCRWorkerInstances)
+            workerHypothesesPairs.emplace_back(pSliceCRWorker, &crSlicePfos);
 
-            const PfoList *pSliceNuPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceNuWorkerInstance));
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceNuWorkerInstance, pSliceNuPfos));
-            nuSliceHypotheses.push_back(*pSliceNuPfos);
+        std::vector<StatusCode> statusCodes(workerHypothesesPairs.size(), STATUS_CODE_SUCCESS);
 
-            for (const ParticleFlowObject *const pPfo : *pSliceNuPfos)
+        LArThreadHelper::ParallelFor(workerHypothesesPairs.size(), m_nSliceWorkerThreads, [&](const unsigned int index) {
+            const Pandora *const pSliceWorker(workerHypothesesPairs.at(index).first);
+            SliceHypotheses &slicePfos(*(workerHypothesesPairs.at(index).second));
+
+            for (unsigned int sliceIndex = index % m_nSliceWorkerInstances; sliceIndex < nSlices; sliceIndex += m_nSliceWorkerInstances)
             {
-                PandoraContentApi::ParticleFlowObject::Metadata metadata;
-                metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+                statusCodes.at(index) = this->RunSliceWorker(pSliceWorker, selectedSliceVector.at(sliceIndex), slicePfos.at(sliceIndex));
+
+                if (STATUS_CODE_SUCCESS != statusCodes.at(index))
+                    break;
             }
-        }
+        });
 
-        if (m_shouldRunCosmicRecoOption)
+        for (const StatusCode statusCode : statusCodes)
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, statusCode);
+    }
+    else
+    {
+        for (unsigned int sliceIndex = 0; sliceIndex < nSlices; ++sliceIndex)
         {
-            if (m_printOverallRecoStatus)
-                std::cout << "Running cr worker instance for slice " << (sliceCounter + 1) << " of " << selectedSliceVector.size() << std::endl;
+            if (m_shouldRunNeutrinoRecoOption)
+            {
+                if (m_printOverallRecoStatus)
+                    std::cout << "Running nu worker instance for slice " << (sliceIndex + 1) << " of " << nSlices << std::endl;
 
-            const PfoList *pSliceCRPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceCRWorkerInstance));
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceCRWorkerInstance, pSliceCRPfos));
-            crSliceHypotheses.push_back(*pSliceCRPfos);
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                    this->RunSliceWorker(m_sliceNuWorkerInstances.front(), selectedSliceVector.at(sliceIndex), nuSlicePfos.at(sliceIndex)));
+            }
 
-            for (const ParticleFlowObject *const pPfo : *pSliceCRPfos)
+            if (m_shouldRunCosmicRecoOption)
             {
-                PandoraContentApi::ParticleFlowObject::Metadata metadata;
-                metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+                if (m_printOverallRecoStatus)
+                    std::cout << "Running cr worker instance for slice " << (sliceIndex + 1) << " of " << nSlices << std::endl;
+
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=,
+                    this->RunSliceWorker(m_sliceCRWorkerInstances.front(), selectedSliceVector.at(sliceIndex), crSlicePfos.at(sliceIndex)));
             }
         }
+    }
+
+    for (unsigned int sliceIndex = 0; sliceIndex < nSlices; ++sliceIndex)
+    {
+        if (m_shouldRunNeutrinoRecoOption)
+        {
+            nuSliceHypotheses.push_back(nuSlicePfos.at(sliceIndex));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetSliceIndex(nuSliceHypotheses.back(), sliceIndex));
+        }
 
-        ++sliceCounter;
+        if (m_shouldRunCosmicRecoOption)
+        {
+            crSliceHypotheses.push_back(crSlicePfos.at(sliceIndex));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetSliceIndex(crSliceHypotheses.back(), sliceIndex));
+        }
     }
 
     // ATTN: If we swapped these objects at the start, be sure to swap them back in case we ever want to use sliceVector
@@ -597,6 +672,39 @@ StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, Sli
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode MasterAlgorithm::RunSliceWorker(const Pandora *const pSliceWorker, const CaloHitList &sliceHits, PfoList &slicePfos) const
+{
+    for (const CaloHit *const pSliceCaloHit : sliceHits)
+    {
+        // ATTN Must ensure we copy the hit actually owned by master instance; access differs with/without slicing enabled
+        const CaloHit *const pCaloHitInMaster(m_shouldRunSlicing ? static_cast<const CaloHit *>(pSliceCaloHit->GetParentAddress()) : pSliceCaloHit);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pSliceWorker, pCaloHitInMaster));
+    }
+
+    const PfoList *pSlicePfos(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pSliceWorker));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*pSliceWorker, pSlicePfos));
+    slicePfos = *pSlicePfos;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::SetSliceIndex(const PfoList &slicePfos, const unsigned int sliceIndex) const
+{
+    for (const ParticleFlowObject *const pPfo : slicePfos)
+    {
+        PandoraContentApi::ParticleFlowObject::Metadata metadata;
+        metadata.m_propertiesToAdd["SliceIndex"] = sliceIndex;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::SelectBestSliceHypotheses(const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses) const
 {
     if (m_printOverallRecoStatus)
@@ -633,11 +741,11 @@ StatusCode MasterAlgorithm::Reset()
     if (m_pSlicingWorkerInstance)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSlicingWorkerInstance));
 
-    if (m_pSliceNuWorkerInstance)
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceNuWorkerInstance));
+    for (const Pandora *const pSliceNuWorker : m_sliceNuWorkerInstances)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pSliceNuWorker));
 
-    if (m_pSliceCRWorkerInstance)
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceCRWorkerInstance));
+    for (const Pandora *const pSliceCRWorker : m_sliceCRWorkerInstances)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pSliceCRWorker));
 
     return STATUS_CODE_SUCCESS;
 }
@@ -1222,6 +1330,24 @@ StatusCode MasterAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "FullWidthCRWorkerWireGaps", m_fullWidthCRWorkerWireGaps));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ShouldRunCRWorkersInParallel", m_shouldRunCRWorkersInParallel));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NCRWorkerThreads", m_nCRWorkerThreads));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NSliceWorkerInstances", m_nSliceWorkerInstances));
+
+    if (0 == m_nSliceWorkerInstances)
+    {
+        std::cout << "MasterAlgorithm::ReadSettings - NSliceWorkerInstances must be at least one" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NSliceWorkerThreads", m_nSliceWorkerThreads));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
         XmlHelper::ReadValue(xmlHandle, "PassMCParticlesToWorkerInstances", m_passMCParticlesToWorkerInstances));
 
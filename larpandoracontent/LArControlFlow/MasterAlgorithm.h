@@ -119,6 +119,14 @@ protected:
      */
     pandora::StatusCode RunCosmicRayReconstruction(const VolumeIdToHitListMap &volumeIdToHitListMap) const;
 
+    /**
+     *  @brief  Run a single cosmic-ray reconstruction worker instance, copying the provided hits and processing the event
+     *
+     *  @param  pCRWorker the address of the cosmic-ray reconstruction worker instance
+     *  @param  caloHitList the list of hits (owned by the master instance) to copy to the worker instance
+     */
+    pandora::StatusCode RunCosmicRayWorker(const pandora::Pandora *const pCRWorker, const pandora::CaloHitList &caloHitList) const;
+
     /**
      *  @brief  Recreate cosmic-ray pfos (created by worker instances) in the master instance
      *
@@ -168,6 +176,23 @@ protected:
      */
     pandora::StatusCode RunSliceReconstruction(SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses, SliceHypotheses &crSliceHypotheses) const;
 
+    /**
+     *  @brief  Run a single slice reconstruction worker instance, copying the slice hits and processing the event
+     *
+     *  @param  pSliceWorker the address of the slice reconstruction worker instance
+     *  @param  sliceHits the list of hits in the slice
+     *  @param  slicePfos to receive the list of pfos produced by the worker instance for this slice
+     */
+    pandora::StatusCode RunSliceWorker(const pandora::Pandora *const pSliceWorker, const pandora::CaloHitList &sliceHits, pandora::PfoList &slicePfos) const;
+
+    /**
+     *  @brief  Label the pfos produced for a given slice with the slice index
+     *
+     *  @param  slicePfos the list of pfos produced for the slice
+     *  @param  sliceIndex the slice index
+     */
+    pandora::StatusCode SetSliceIndex(const pandora::PfoList &slicePfos, const unsigned int sliceIndex) const;
+
     /**
      *  @brief  Examine slice hypotheses to identify the most appropriate to provide in final event output
      *
@@ -322,10 +347,15 @@ protected:
     bool m_visualizeOverallRecoStatus;  ///< Whether to display results of current operations
     bool m_shouldRemoveOutOfTimeHits;   ///< Whether to remove out of time hits
 
+    bool m_shouldRunCRWorkersInParallel; ///< Whether to run the per-LArTPC cosmic-ray reconstruction worker instances concurrently
+    unsigned int m_nCRWorkerThreads;     ///< The maximum number of threads to use when running cosmic-ray worker instances concurrently
+
     PandoraInstanceList m_crWorkerInstances;          ///< The list of cosmic-ray reconstruction worker instances
     const pandora::Pandora *m_pSlicingWorkerInstance; ///< The slicing worker instance
-    const pandora::Pandora *m_pSliceNuWorkerInstance; ///< The per-slice neutrino reconstruction worker instance
-    const pandora::Pandora *m_pSliceCRWorkerInstance; ///< The per-slice cosmic-ray reconstruction worker instance
+    PandoraInstanceList m_sliceNuWorkerInstances;     ///< The per-slice neutrino reconstruction worker instances
+    PandoraInstanceList m_sliceCRWorkerInstances;     ///< The per-slice cosmic-ray reconstruction worker instances
+    unsigned int m_nSliceWorkerInstances;             ///< The number of slice worker instances of each kind, run concurrently if more than one
+    unsigned int m_nSliceWorkerThreads;               ///< The maximum number of threads with which to run slice worker instances
 
     bool m_fullWidthCRWorkerWireGaps;        ///< Whether wire-type line gaps in cosmic-ray worker instances should cover all drift time
     bool m_passMCParticlesToWorkerInstances; ///< Whether to pass mc particle details (and links to calo hits) to worker instances
@@ -71,7 +71,7 @@ void NeutrinoIdTool<T>::SelectOutputPfos(const Algorithm *const pAlgorithm, cons
 
             LArMvaHelper::MvaFeatureVector featureVector;
             features.GetFeatureVector(featureVector);
-            LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, sliceIndex == bestSliceIndex, featureVector);
+            LArMvaHelper::ProduceTrainingExample(*m_pTrainingWriter, m_trainingOutputFile, sliceIndex == bestSliceIndex, featureVector);
         }
 
         return;
@@ -554,6 +554,7 @@ StatusCode NeutrinoIdTool<T>::ReadSettings(const TiXmlHandle xmlHandle)
     if (m_useTrainingMode)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFileName", m_trainingOutputFile));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, MvaTrainingWriter::Create(xmlHandle, m_pTrainingWriter));
     }
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinimumPurity", m_minPurity));
@@ -11,9 +11,11 @@
 #include "larpandoracontent/LArControlFlow/MasterAlgorithm.h"
 
 #include "larpandoracontent/LArObjects/LArAdaBoostDecisionTree.h"
+#include "larpandoracontent/LArObjects/LArMvaTrainingWriter.h"
 #include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
 
 #include <functional>
+#include <memory>
 
 namespace lar_content
 {
@@ -255,6 +257,8 @@ private:
     float m_minPurity;                ///< Minimum purity of the best slice to use event for training
     float m_minCompleteness;          ///< Minimum completeness of the best slice to use event for training
 
+    std::unique_ptr<MvaTrainingWriter> m_pTrainingWriter; ///< The writer for training examples, keeping the output file open
+
     // Classification
     float m_minProbability;      ///< Minimum probability required to classify a slice as the neutrino
     unsigned int m_maxNeutrinos; ///< The maximum number of neutrinos to select in any one event
@@ -25,8 +25,12 @@ PreProcessingAlgorithm::PreProcessingAlgorithm() :
     m_maxCellLengthScale(3.f),
     m_searchRegion1D(0.1f),
     m_maxEventHits(std::numeric_limits<unsigned int>::max()),
+    m_maxEventHitsPerSlice(false),
+    m_degradeExcessiveEvents(false),
+    m_isolationSearchRegion1D(2.f),
     m_onlyAvailableCaloHits(true),
-    m_inputCaloHitListName("Input")
+    m_inputCaloHitListName("Input"),
+    m_droppedCaloHitListName("DroppedCaloHits")
 {
 }
 
@@ -35,6 +39,7 @@ PreProcessingAlgorithm::PreProcessingAlgorithm() :
 StatusCode PreProcessingAlgorithm::Reset()
 {
     m_processedHits.clear();
+    LArClusterHelper::ResetClusterHitIndices();
     return STATUS_CODE_SUCCESS;
 }
 
@@ -84,8 +89,20 @@ void PreProcessingAlgorithm::ProcessCaloHits()
     if (pCaloHitList->empty())
         return;
 
-    if (pCaloHitList->size() > m_maxEventHits)
-        throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+    if (!m_degradeExcessiveEvents && (pCaloHitList->size() > m_maxEventHits))
+    {
+        unsigned int nEventHits(pCaloHitList->size());
+
+        // ATTN Slice worker instances process several slices between resets, so the input list also holds the hits of earlier slices
+        if (m_maxEventHitsPerSlice)
+        {
+            nEventHits -= std::count_if(pCaloHitList->begin(), pCaloHitList->end(),
+                [this](const CaloHit *const pCaloHit) { return (m_processedHits.count(pCaloHit) > 0); });
+        }
+
+        if (nEventHits > m_maxEventHits)
+            throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+    }
 
     CaloHitList selectedCaloHitListU, selectedCaloHitListV, selectedCaloHitListW;
 
@@ -135,10 +152,18 @@ void PreProcessingAlgorithm::ProcessCaloHits()
         }
     }
 
+    HitKDTree2D kdTreeU, kdTreeV, kdTreeW;
+    this->BuildKDTree(selectedCaloHitListU, kdTreeU);
+    this->BuildKDTree(selectedCaloHitListV, kdTreeV);
+    this->BuildKDTree(selectedCaloHitListW, kdTreeW);
+
     CaloHitList filteredCaloHitListU, filteredCaloHitListV, filteredCaloHitListW;
-    this->GetFilteredCaloHitList(selectedCaloHitListU, filteredCaloHitListU);
-    this->GetFilteredCaloHitList(selectedCaloHitListV, filteredCaloHitListV);
-    this->GetFilteredCaloHitList(selectedCaloHitListW, filteredCaloHitListW);
+    this->GetFilteredCaloHitList(selectedCaloHitListU, kdTreeU, filteredCaloHitListU);
+    this->GetFilteredCaloHitList(selectedCaloHitListV, kdTreeV, filteredCaloHitListV);
+    this->GetFilteredCaloHitList(selectedCaloHitListW, kdTreeW, filteredCaloHitListW);
+
+    if (m_degradeExcessiveEvents && (filteredCaloHitListU.size() + filteredCaloHitListV.size() + filteredCaloHitListW.size() > m_maxEventHits))
+        this->ApplyHitBudget(kdTreeU, kdTreeV, kdTreeW, filteredCaloHitListU, filteredCaloHitListV, filteredCaloHitListW);
 
     CaloHitList filteredInputList;
     filteredInputList.insert(filteredInputList.end(), filteredCaloHitListU.begin(), filteredCaloHitListU.end());
@@ -186,22 +211,28 @@ void PreProcessingAlgorithm::PopulateVoidCaloHitLists() noexcept
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList, CaloHitList &outputList)
+void PreProcessingAlgorithm::BuildKDTree(const CaloHitList &inputList, HitKDTree2D &kdTree) const
 {
-    HitKDTree2D kdTree;
-    HitKDNode2DList hitKDNode2DList;
+    if (inputList.empty())
+        return;
 
+    HitKDNode2DList hitKDNode2DList;
     KDTreeBox hitsBoundingRegion2D = fill_and_bound_2d_kd_tree(inputList, hitKDNode2DList);
     kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
+void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList, const HitKDTree2D &kdTree, CaloHitList &outputList)
+{
     // Remove hits that are in the same physical location!
     for (const CaloHit *const pCaloHit1 : inputList)
     {
         bool isUnique(true);
-        KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit1, m_searchRegion1D, m_searchRegion1D));
+        const CartesianVector &position1(pCaloHit1->GetPositionVector());
 
         HitKDNode2DList found;
-        kdTree.search(searchRegionHits, found);
+        kdTree.searchRadius(HitKDNode2D(pCaloHit1, position1.GetX(), position1.GetZ()), m_searchRegion1D, found);
 
         for (const auto &hit : found)
         {
@@ -240,6 +271,95 @@ void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void PreProcessingAlgorithm::ApplyHitBudget(const HitKDTree2D &kdTreeU, const HitKDTree2D &kdTreeV, const HitKDTree2D &kdTreeW,
+    CaloHitList &filteredCaloHitListU, CaloHitList &filteredCaloHitListV, CaloHitList &filteredCaloHitListW)
+{
+    CaloHitSet isolatedHits;
+    this->GetIsolatedCaloHits(filteredCaloHitListU, kdTreeU, isolatedHits);
+    this->GetIsolatedCaloHits(filteredCaloHitListV, kdTreeV, isolatedHits);
+    this->GetIsolatedCaloHits(filteredCaloHitListW, kdTreeW, isolatedHits);
+
+    CaloHitVector candidateHits;
+    candidateHits.insert(candidateHits.end(), filteredCaloHitListU.begin(), filteredCaloHitListU.end());
+    candidateHits.insert(candidateHits.end(), filteredCaloHitListV.begin(), filteredCaloHitListV.end());
+    candidateHits.insert(candidateHits.end(), filteredCaloHitListW.begin(), filteredCaloHitListW.end());
+
+    if (candidateHits.size() <= m_maxEventHits)
+        return;
+
+    // Order hits by dropping preference: isolated hits first, then by increasing input energy, keeping the list order in the event of a tie
+    std::stable_sort(candidateHits.begin(), candidateHits.end(), [&isolatedHits](const CaloHit *const pLhs, const CaloHit *const pRhs) {
+        const bool isLhsIsolated(isolatedHits.count(pLhs) > 0), isRhsIsolated(isolatedHits.count(pRhs) > 0);
+
+        if (isLhsIsolated != isRhsIsolated)
+            return isLhsIsolated;
+
+        return (pLhs->GetInputEnergy() < pRhs->GetInputEnergy());
+    });
+
+    const unsigned int nDroppedHits(candidateHits.size() - m_maxEventHits);
+    const CaloHitSet droppedHits(candidateHits.begin(), candidateHits.begin() + nDroppedHits);
+
+    CaloHitList droppedCaloHitList;
+
+    for (CaloHitList *const pCaloHitList : {&filteredCaloHitListU, &filteredCaloHitListV, &filteredCaloHitListW})
+    {
+        for (CaloHitList::iterator iter = pCaloHitList->begin(); iter != pCaloHitList->end();)
+        {
+            if (droppedHits.count(*iter))
+            {
+                droppedCaloHitList.push_back(*iter);
+                iter = pCaloHitList->erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+    }
+
+    if (PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo())
+    {
+        unsigned int nDroppedIsolatedHits(0);
+
+        for (const CaloHit *const pCaloHit : droppedHits)
+        {
+            if (isolatedHits.count(pCaloHit))
+                ++nDroppedIsolatedHits;
+        }
+
+        std::cout << "PreProcessingAlgorithm: Excessive number of hits in event, dropped " << nDroppedHits << " of " << candidateHits.size()
+                  << " hits (" << nDroppedIsolatedHits << " isolated) to proceed with " << m_maxEventHits << " hits" << std::endl;
+    }
+
+    // ATTN The dropped hits are always saved, so that the degradation, and the number of hits dropped, can be queried downstream
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList(*this, droppedCaloHitList, m_droppedCaloHitListName));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void PreProcessingAlgorithm::GetIsolatedCaloHits(const CaloHitList &inputList, const HitKDTree2D &kdTree, CaloHitSet &isolatedHits) const
+{
+    // ATTN The kd tree also holds the hits removed as duplicates, which must not count as neighbours
+    const CaloHitSet inputHits(inputList.begin(), inputList.end());
+
+    for (const CaloHit *const pCaloHit : inputList)
+    {
+        const CartesianVector &position(pCaloHit->GetPositionVector());
+
+        HitKDNode2DList found;
+        kdTree.searchRadius(HitKDNode2D(pCaloHit, position.GetX(), position.GetZ()), m_isolationSearchRegion1D, found);
+
+        const bool hasNeighbour(std::any_of(found.begin(), found.end(),
+            [pCaloHit, &inputHits](const HitKDNode2D &hit) { return ((hit.data != pCaloHit) && inputHits.count(hit.data)); }));
+
+        if (!hasNeighbour)
+            (void)isolatedHits.insert(pCaloHit);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode PreProcessingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -255,6 +375,15 @@ StatusCode PreProcessingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxEventHits", m_maxEventHits));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MaxEventHitsPerSlice", m_maxEventHitsPerSlice));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "DegradeExcessiveEvents", m_degradeExcessiveEvents));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "IsolationSearchRegion1D", m_isolationSearchRegion1D));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "OnlyAvailableCaloHits", m_onlyAvailableCaloHits));
 
@@ -269,6 +398,9 @@ StatusCode PreProcessingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "FilteredCaloHitListName", m_filteredCaloHitListName));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "DroppedCaloHitListName", m_droppedCaloHitListName));
+
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "CurrentCaloHitListReplacement", m_currentCaloHitListReplacement));
 
     return STATUS_CODE_SUCCESS;
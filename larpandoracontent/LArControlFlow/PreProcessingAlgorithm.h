@@ -50,13 +50,45 @@ private:
      */
     void PopulateVoidCaloHitLists() noexcept;
 
+    /**
+     *  @brief Build a kd tree holding the hits in a single view CaloHitList
+     *
+     *  @param inputList the input CaloHitList
+     *  @param kdTree to receive the kd tree
+     */
+    void BuildKDTree(const pandora::CaloHitList &inputList, HitKDTree2D &kdTree) const;
+
     /**
      *  @brief Clean up the input CaloHitList
      *
      *  @param inputList the input CaloHitList
+     *  @param kdTree the kd tree holding the hits in the input CaloHitList
      *  @param outputList the output CaloHitList
      */
-    void GetFilteredCaloHitList(const pandora::CaloHitList &inputList, pandora::CaloHitList &outputList);
+    void GetFilteredCaloHitList(const pandora::CaloHitList &inputList, const HitKDTree2D &kdTree, pandora::CaloHitList &outputList);
+
+    /**
+     *  @brief Remove hits from the filtered lists until the event is within the hit budget, dropping isolated hits first and then the
+     *         hits with the lowest input energy
+     *
+     *  @param kdTreeU the kd tree holding the selected TPC_VIEW_U hits
+     *  @param kdTreeV the kd tree holding the selected TPC_VIEW_V hits
+     *  @param kdTreeW the kd tree holding the selected TPC_VIEW_W hits
+     *  @param filteredCaloHitListU the filtered CaloHitList for TPC_VIEW_U hits
+     *  @param filteredCaloHitListV the filtered CaloHitList for TPC_VIEW_V hits
+     *  @param filteredCaloHitListW the filtered CaloHitList for TPC_VIEW_W hits
+     */
+    void ApplyHitBudget(const HitKDTree2D &kdTreeU, const HitKDTree2D &kdTreeV, const HitKDTree2D &kdTreeW,
+        pandora::CaloHitList &filteredCaloHitListU, pandora::CaloHitList &filteredCaloHitListV, pandora::CaloHitList &filteredCaloHitListW);
+
+    /**
+     *  @brief Find the hits in a single view CaloHitList with no other hit of the list within the isolation search distance
+     *
+     *  @param inputList the input CaloHitList
+     *  @param kdTree a kd tree holding (at least) the hits in the input CaloHitList
+     *  @param isolatedHits to receive the isolated hits
+     */
+    void GetIsolatedCaloHits(const pandora::CaloHitList &inputList, const HitKDTree2D &kdTree, pandora::CaloHitSet &isolatedHits) const;
 
     /**
      *  @brief Build separate MCParticleLists for each view
@@ -65,11 +97,14 @@ private:
 
     pandora::CaloHitSet m_processedHits; ///< The set of all previously processed calo hits
 
-    float m_mipEquivalentCut;    ///< Minimum mip equivalent energy for calo hit
-    float m_minCellLengthScale;  ///< The minimum length scale for calo hit
-    float m_maxCellLengthScale;  ///< The maximum length scale for calo hit
-    float m_searchRegion1D;      ///< Search region, applied to each dimension, for look-up from kd-trees
-    unsigned int m_maxEventHits; ///< The maximum number of hits in an event to proceed with the reconstruction
+    float m_mipEquivalentCut;        ///< Minimum mip equivalent energy for calo hit
+    float m_minCellLengthScale;      ///< The minimum length scale for calo hit
+    float m_maxCellLengthScale;      ///< The maximum length scale for calo hit
+    float m_searchRegion1D;          ///< Search distance for look-up of hits in the same location from kd-trees
+    unsigned int m_maxEventHits;     ///< The maximum number of hits in an event to proceed with the reconstruction
+    bool m_maxEventHitsPerSlice;     ///< Whether the maximum number of hits only counts hits not processed since the last reset
+    bool m_degradeExcessiveEvents;   ///< Whether to drop hits to meet the maximum number of hits, rather than skipping the reconstruction
+    float m_isolationSearchRegion1D; ///< Search distance within which a hit without neighbours is isolated
 
     bool m_onlyAvailableCaloHits;                ///< Whether to only include available calo hits
     std::string m_inputCaloHitListName;          ///< The input calo hit list name
@@ -77,6 +112,7 @@ private:
     std::string m_outputCaloHitListNameV;        ///< The output calo hit list name for TPC_VIEW_V hits
     std::string m_outputCaloHitListNameW;        ///< The output calo hit list name for TPC_VIEW_W hits
     std::string m_filteredCaloHitListName;       ///< The output calo hit list name for all U, V and W hits
+    std::string m_droppedCaloHitListName;        ///< The output calo hit list name for hits dropped to meet the hit budget
     std::string m_currentCaloHitListReplacement; ///< The name of the calo hit list to replace the current list (optional)
 };
 
@@ -17,6 +17,9 @@
 
 #include "larpandoracontent/LArControlFlow/StitchingCosmicRayMergingTool.h"
 
+#include <algorithm>
+#include <cmath>
+
 using namespace pandora;
 
 namespace lar_content
@@ -147,23 +150,38 @@ void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPCToPfoMap &larTP
         larTPCVector.push_back(mapEntry.first);
     std::sort(larTPCVector.begin(), larTPCVector.end(), LArStitchingHelper::SortTPCs);
 
+    LArTPCToStitchingCandidatesMap larTPCToStitchingCandidatesMap;
+    for (const LArTPC *const pLArTPC : larTPCVector)
+        this->GetStitchingCandidates(larTPCToPfoMap.at(pLArTPC), pointingClusterMap, larTPCToStitchingCandidatesMap[pLArTPC]);
+
     for (LArTPCVector::const_iterator tpcIter1 = larTPCVector.begin(), tpcIterEnd = larTPCVector.end(); tpcIter1 != tpcIterEnd; ++tpcIter1)
     {
         const LArTPC *const pLArTPC1(*tpcIter1);
-        const PfoList &pfoList1(larTPCToPfoMap.at(pLArTPC1));
+        const TPCStitchingCandidates &tpcStitchingCandidates1(larTPCToStitchingCandidatesMap.at(pLArTPC1));
 
         for (LArTPCVector::const_iterator tpcIter2 = tpcIter1; tpcIter2 != tpcIterEnd; ++tpcIter2)
         {
             const LArTPC *const pLArTPC2(*tpcIter2);
-            const PfoList &pfoList2(larTPCToPfoMap.at(pLArTPC2));
+            const TPCStitchingCandidates &tpcStitchingCandidates2(larTPCToStitchingCandidatesMap.at(pLArTPC2));
 
             if (!LArStitchingHelper::CanTPCsBeStitched(*pLArTPC1, *pLArTPC2))
                 continue;
 
-            for (const ParticleFlowObject *const pPfo1 : pfoList1)
+            // Get centre and width of boundary between tpcs
+            const float boundaryCenterX(LArStitchingHelper::GetTPCBoundaryCenterX(*pLArTPC1, *pLArTPC2));
+            const float boundaryWidthX(LArStitchingHelper::GetTPCBoundaryWidthX(*pLArTPC1, *pLArTPC2));
+            const float maxLongitudinalDisplacementX(m_maxLongitudinalDisplacementX + boundaryWidthX);
+
+            for (const StitchingCandidate &candidate1 : tpcStitchingCandidates1.m_candidates)
             {
-                for (const ParticleFlowObject *const pPfo2 : pfoList2)
-                    this->CreatePfoMatches(*pLArTPC1, *pLArTPC2, pPfo1, pPfo2, pointingClusterMap, pfoAssociationMatrix);
+                std::vector<unsigned int> candidateIndices;
+                this->GetCandidateIndices(candidate1, tpcStitchingCandidates2, boundaryCenterX, maxLongitudinalDisplacementX, candidateIndices);
+
+                for (const unsigned int index2 : candidateIndices)
+                {
+                    this->CreatePfoMatches(*pLArTPC1, *pLArTPC2, boundaryCenterX, maxLongitudinalDisplacementX, candidate1,
+                        tpcStitchingCandidates2.m_candidates.at(index2), pfoAssociationMatrix);
+                }
             }
         }
     }
@@ -171,38 +189,102 @@ void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPCToPfoMap &larTP
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPC &larTPC1, const LArTPC &larTPC2, const ParticleFlowObject *const pPfo1,
-    const ParticleFlowObject *const pPfo2, const ThreeDPointingClusterMap &pointingClusterMap, PfoAssociationMatrix &pfoAssociationMatrix) const
+void StitchingCosmicRayMergingTool::GetStitchingCandidates(
+    const PfoList &pfoList, const ThreeDPointingClusterMap &pointingClusterMap, TPCStitchingCandidates &tpcStitchingCandidates) const
 {
-    // Get centre and width of boundary between tpcs
-    const float boundaryCenterX(LArStitchingHelper::GetTPCBoundaryCenterX(larTPC1, larTPC2));
-    const float boundaryWidthX(LArStitchingHelper::GetTPCBoundaryWidthX(larTPC1, larTPC2));
-    const float maxLongitudinalDisplacementX(m_maxLongitudinalDisplacementX + boundaryWidthX);
+    tpcStitchingCandidates.m_maxAbsX = 0.f;
 
-    // Get the pointing cluster corresponding to each of these Pfos
-    ThreeDPointingClusterMap::const_iterator iter1 = pointingClusterMap.find(pPfo1);
-    ThreeDPointingClusterMap::const_iterator iter2 = pointingClusterMap.find(pPfo2);
+    for (const ParticleFlowObject *const pPfo : pfoList)
+    {
+        // Get the pointing cluster corresponding to this Pfo
+        ThreeDPointingClusterMap::const_iterator iter = pointingClusterMap.find(pPfo);
 
-    if (pointingClusterMap.end() == iter1 || pointingClusterMap.end() == iter2)
-        return;
+        if (pointingClusterMap.end() == iter)
+            continue;
 
-    const LArPointingCluster &pointingCluster1(iter1->second);
-    const LArPointingCluster &pointingCluster2(iter2->second);
+        const LArPointingCluster &pointingCluster(iter->second);
 
-    // Check length of pointing clusters
-    if (pointingCluster1.GetLengthSquared() < m_minLengthSquared || pointingCluster2.GetLengthSquared() < m_minLengthSquared)
-        return;
+        // Check length of pointing cluster
+        if (pointingCluster.GetLengthSquared() < m_minLengthSquared)
+            continue;
+
+        // Check number of 3D hits in the pfo
+        CaloHitList caloHitList3D;
+        LArPfoHelper::GetCaloHits(pPfo, TPC_3D, caloHitList3D);
+
+        if (caloHitList3D.size() < m_minNCaloHits3D)
+            continue;
+
+        const float innerX(pointingCluster.GetInnerVertex().GetPosition().GetX());
+        const float outerX(pointingCluster.GetOuterVertex().GetPosition().GetX());
+        const unsigned int index(tpcStitchingCandidates.m_candidates.size());
+
+        tpcStitchingCandidates.m_candidates.push_back({pPfo, &pointingCluster, std::min(innerX, outerX), std::max(innerX, outerX)});
+
+        // ATTN Candidates with non-finite vertex x coordinates cannot be ordered, so are always considered
+        if (!std::isfinite(innerX) || !std::isfinite(outerX))
+        {
+            tpcStitchingCandidates.m_unorderedIndices.push_back(index);
+            continue;
+        }
 
-    // Get number of 3D hits in each of the pfos
-    CaloHitList caloHitList3D1;
-    LArPfoHelper::GetCaloHits(pPfo1, TPC_3D, caloHitList3D1);
+        tpcStitchingCandidates.m_minXOrderedIndices.push_back(index);
+        tpcStitchingCandidates.m_maxAbsX = std::max(tpcStitchingCandidates.m_maxAbsX, std::max(std::fabs(innerX), std::fabs(outerX)));
+    }
+
+    const StitchingCandidateVector &candidates(tpcStitchingCandidates.m_candidates);
+    std::stable_sort(tpcStitchingCandidates.m_minXOrderedIndices.begin(), tpcStitchingCandidates.m_minXOrderedIndices.end(),
+        [&candidates](const unsigned int lhs, const unsigned int rhs) { return candidates.at(lhs).m_minX < candidates.at(rhs).m_minX; });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    CaloHitList caloHitList3D2;
-    LArPfoHelper::GetCaloHits(pPfo2, TPC_3D, caloHitList3D2);
+void StitchingCosmicRayMergingTool::GetCandidateIndices(const StitchingCandidate &candidate1, const TPCStitchingCandidates &tpcStitchingCandidates2,
+    const float boundaryCenterX, const float maxLongitudinalDisplacementX, std::vector<unsigned int> &candidateIndices) const
+{
+    const StitchingCandidateVector &candidates2(tpcStitchingCandidates2.m_candidates);
+
+    if (!std::isfinite(boundaryCenterX) || !std::isfinite(maxLongitudinalDisplacementX) || !std::isfinite(candidate1.m_minX) ||
+        !std::isfinite(candidate1.m_maxX))
+    {
+        for (unsigned int index2 = 0; index2 < candidates2.size(); ++index2)
+            candidateIndices.push_back(index2);
 
-    // Check number of 3D hits in each of the pfos
-    if (caloHitList3D1.size() < m_minNCaloHits3D || caloHitList3D2.size() < m_minNCaloHits3D)
         return;
+    }
+
+    // The vertex intersection, midway between one vertex of each pointing cluster, must lie within the maximum displacement of the
+    // boundary centre, so 2 * (centre - displacement) <= x1 + x2 <= 2 * (centre + displacement). ATTN Generous margin for rounding.
+    const float tolerance(1.f + 0.001f * (std::fabs(boundaryCenterX) + std::fabs(maxLongitudinalDisplacementX) + std::fabs(candidate1.m_minX) +
+                                             std::fabs(candidate1.m_maxX) + tpcStitchingCandidates2.m_maxAbsX));
+    const float maxMinX2(2.f * (boundaryCenterX + maxLongitudinalDisplacementX) - candidate1.m_minX + tolerance);
+    const float minMaxX2(2.f * (boundaryCenterX - maxLongitudinalDisplacementX) - candidate1.m_maxX - tolerance);
+
+    const std::vector<unsigned int> &minXOrderedIndices(tpcStitchingCandidates2.m_minXOrderedIndices);
+    const std::vector<unsigned int>::const_iterator endIter(std::partition_point(minXOrderedIndices.begin(), minXOrderedIndices.end(),
+        [&candidates2, maxMinX2](const unsigned int index2) { return !(candidates2.at(index2).m_minX > maxMinX2); }));
+
+    for (std::vector<unsigned int>::const_iterator iter = minXOrderedIndices.begin(); iter != endIter; ++iter)
+    {
+        if (!(candidates2.at(*iter).m_maxX < minMaxX2))
+            candidateIndices.push_back(*iter);
+    }
+
+    candidateIndices.insert(
+        candidateIndices.end(), tpcStitchingCandidates2.m_unorderedIndices.begin(), tpcStitchingCandidates2.m_unorderedIndices.end());
+    std::sort(candidateIndices.begin(), candidateIndices.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void StitchingCosmicRayMergingTool::CreatePfoMatches(const LArTPC &larTPC1, const LArTPC &larTPC2, const float boundaryCenterX,
+    const float maxLongitudinalDisplacementX, const StitchingCandidate &candidate1, const StitchingCandidate &candidate2,
+    PfoAssociationMatrix &pfoAssociationMatrix) const
+{
+    const ParticleFlowObject *const pPfo1(candidate1.m_pPfo);
+    const ParticleFlowObject *const pPfo2(candidate2.m_pPfo);
+    const LArPointingCluster &pointingCluster1(*candidate1.m_pPointingCluster);
+    const LArPointingCluster &pointingCluster2(*candidate2.m_pPointingCluster);
 
     // Get closest pair of vertices
     LArPointingCluster::Vertex pointingVertex1, pointingVertex2;
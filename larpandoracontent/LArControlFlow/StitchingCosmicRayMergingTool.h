@@ -13,6 +13,7 @@
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace lar_content
 {
@@ -121,6 +122,34 @@ private:
     typedef std::unordered_map<const pandora::ParticleFlowObject *, PfoAssociation> PfoAssociationMap;
     typedef std::unordered_map<const pandora::ParticleFlowObject *, PfoAssociationMap> PfoAssociationMatrix;
 
+    /**
+     *  @brief  StitchingCandidate class, describing a Pfo that passes the pointing cluster length and hit requirements for stitching
+     */
+    class StitchingCandidate
+    {
+    public:
+        const pandora::ParticleFlowObject *m_pPfo;    ///< The address of the Pfo
+        const LArPointingCluster *m_pPointingCluster; ///< The address of the 3D pointing cluster for the Pfo
+        float m_minX;                                 ///< The minimum x coordinate of the pointing cluster vertices
+        float m_maxX;                                 ///< The maximum x coordinate of the pointing cluster vertices
+    };
+
+    typedef std::vector<StitchingCandidate> StitchingCandidateVector;
+
+    /**
+     *  @brief  TPCStitchingCandidates class, holding the stitching candidates for a tpc, indexed by the x coordinates of their vertices
+     */
+    class TPCStitchingCandidates
+    {
+    public:
+        StitchingCandidateVector m_candidates;          ///< The stitching candidates, in the order of the tpc Pfo list
+        std::vector<unsigned int> m_minXOrderedIndices; ///< The indices of candidates with finite vertex x coordinates, ordered by minimum x
+        std::vector<unsigned int> m_unorderedIndices;   ///< The indices of candidates with non-finite vertex x coordinates
+        float m_maxAbsX;                                ///< The maximum absolute vertex x coordinate of the ordered candidates
+    };
+
+    typedef std::unordered_map<const pandora::LArTPC *, TPCStitchingCandidates> LArTPCToStitchingCandidatesMap;
+
     /**
      *  @brief  Create associations between Pfos using 3D pointing clusters
      *
@@ -131,18 +160,42 @@ private:
     void CreatePfoMatches(const LArTPCToPfoMap &larTPCToPfoMap, const ThreeDPointingClusterMap &pointingClusterMap,
         PfoAssociationMatrix &pfoAssociationMatrix) const;
 
+    /**
+     *  @brief  Select the Pfos in a tpc that pass the pointing cluster length and hit requirements, and index them by vertex x coordinate
+     *
+     *  @param  pfoList the list of Pfos in the tpc
+     *  @param  pointingClusterMap the input mapping between Pfos and their corresponding 3D pointing clusters
+     *  @param  tpcStitchingCandidates to receive the stitching candidates for the tpc
+     */
+    void GetStitchingCandidates(
+        const pandora::PfoList &pfoList, const ThreeDPointingClusterMap &pointingClusterMap, TPCStitchingCandidates &tpcStitchingCandidates) const;
+
+    /**
+     *  @brief  Get the indices of the stitching candidates in a second tpc that could meet a given candidate at the tpc boundary, i.e.
+     *          whose pointing cluster vertices could lie either side of the boundary within the maximum longitudinal displacement
+     *
+     *  @param  candidate1 the stitching candidate in the first tpc
+     *  @param  tpcStitchingCandidates2 the stitching candidates in the second tpc
+     *  @param  boundaryCenterX the x coordinate of the centre of the boundary between the tpcs
+     *  @param  maxLongitudinalDisplacementX the maximum x displacement of the vertex intersection from the centre of the boundary
+     *  @param  candidateIndices to receive the candidate indices, in the order of the second tpc Pfo list
+     */
+    void GetCandidateIndices(const StitchingCandidate &candidate1, const TPCStitchingCandidates &tpcStitchingCandidates2,
+        const float boundaryCenterX, const float maxLongitudinalDisplacementX, std::vector<unsigned int> &candidateIndices) const;
+
     /**
      *  @brief  Create associations between Pfos using 3D pointing clusters
      *
      *  @param  larTPC1 the tpc description for the first Pfo
      *  @param  larTPC2 the tpc description for the second Pfo
-     *  @param  pPfo1 the first Pfo
-     *  @param  pPfo2 the second Pfo
-     *  @param  pointingClusterMap the input mapping between Pfos and their corresponding 3D pointing clusters
+     *  @param  boundaryCenterX the x coordinate of the centre of the boundary between the tpcs
+     *  @param  maxLongitudinalDisplacementX the maximum x displacement of the vertex intersection from the centre of the boundary
+     *  @param  candidate1 the stitching candidate for the first Pfo
+     *  @param  candidate2 the stitching candidate for the second Pfo
      *  @param  pfoAssociationMatrix the output matrix of associations between Pfos
      */
-    void CreatePfoMatches(const pandora::LArTPC &larTPC1, const pandora::LArTPC &larTPC2, const pandora::ParticleFlowObject *const pPfo1,
-        const pandora::ParticleFlowObject *const pPfo2, const ThreeDPointingClusterMap &pointingClusterMap,
+    void CreatePfoMatches(const pandora::LArTPC &larTPC1, const pandora::LArTPC &larTPC2, const float boundaryCenterX,
+        const float maxLongitudinalDisplacementX, const StitchingCandidate &candidate1, const StitchingCandidate &candidate2,
         PfoAssociationMatrix &pfoAssociationMatrix) const;
 
     typedef std::unordered_map<const pandora::ParticleFlowObject *, pandora::PfoList> PfoMergeMap;
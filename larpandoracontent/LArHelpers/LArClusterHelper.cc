@@ -272,6 +272,15 @@ CartesianVector LArClusterHelper::GetClosestPosition(const CartesianVector &posi
 void LArClusterHelper::GetClosestPositions(
     const Cluster *const pCluster1, const Cluster *const pCluster2, CartesianVector &outputPosition1, CartesianVector &outputPosition2)
 {
+    // Small clusters are compared directly, as any gain from the hit index would be outweighed by the cost of validating it
+    const unsigned int maxBruteForceHitPairs(256);
+
+    if (pCluster1->GetNCaloHits() * pCluster2->GetNCaloHits() > maxBruteForceHitPairs)
+    {
+        LArClusterHelper::GetClosestPositionsUsingIndex(pCluster1, pCluster2, outputPosition1, outputPosition2);
+        return;
+    }
+
     bool distanceFound(false);
     float minDistanceSquared(std::numeric_limits<float>::max());
 
@@ -318,6 +327,82 @@ void LArClusterHelper::GetClosestPositions(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LArClusterHelper::GetClosestPositionsUsingIndex(
+    const Cluster *const pCluster1, const Cluster *const pCluster2, CartesianVector &outputPosition1, CartesianVector &outputPosition2)
+{
+    ClusterHitIndex &hitIndex2(LArClusterHelper::GetClusterHitIndex(pCluster2));
+    const std::vector<unsigned int> &xOrderedIndices2(hitIndex2.GetXOrderedIndices());
+    const FloatVector &xOrderedX2(hitIndex2.m_xOrderedX), &xOrderedY2(hitIndex2.m_xOrderedY), &xOrderedZ2(hitIndex2.m_xOrderedZ);
+    const CartesianVector &minimum2(hitIndex2.m_minimumCoordinate), &maximum2(hitIndex2.m_maximumCoordinate);
+    const int nHits2(xOrderedIndices2.size());
+
+    bool distanceFound(false);
+    float minDistanceSquared(std::numeric_limits<float>::max());
+    unsigned int bestIndex1(std::numeric_limits<unsigned int>::max()), bestIndex2(std::numeric_limits<unsigned int>::max());
+
+    CartesianVector closestPosition1(0.f, 0.f, 0.f);
+    CartesianVector closestPosition2(0.f, 0.f, 0.f);
+
+    // ATTN Reproduces the brute force result exactly: for equal distances, the first pair in (hit 1, hit 2) iteration order is chosen
+    unsigned int index1(0);
+
+    for (const OrderedCaloHitList::value_type &layerEntry1 : pCluster1->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit1 : *layerEntry1.second)
+        {
+            const unsigned int thisIndex1(index1++);
+            const CartesianVector &positionVector1(pCaloHit1->GetPositionVector());
+            const float x1(positionVector1.GetX()), y1(positionVector1.GetY()), z1(positionVector1.GetZ());
+
+            // Lower bound on the distance to any hit in cluster 2, using the same floating point operations as the distance itself
+            const float dX(std::max(0.f, std::max(minimum2.GetX() - x1, x1 - maximum2.GetX())));
+            const float dY(std::max(0.f, std::max(minimum2.GetY() - y1, y1 - maximum2.GetY())));
+            const float dZ(std::max(0.f, std::max(minimum2.GetZ() - z1, z1 - maximum2.GetZ())));
+
+            if (dX * dX + dY * dY + dZ * dZ > minDistanceSquared)
+                continue;
+
+            // Examine cluster 2 hits outwards in x, stopping once the x separation alone exceeds the best distance found so far
+            const int startIndex(std::lower_bound(xOrderedX2.begin(), xOrderedX2.end(), x1) - xOrderedX2.begin());
+
+            for (const int step : {1, -1})
+            {
+                for (int xIndex = ((step > 0) ? startIndex : startIndex - 1); (xIndex >= 0) && (xIndex < nHits2); xIndex += step)
+                {
+                    const float deltaX(x1 - xOrderedX2[xIndex]);
+
+                    if (deltaX * deltaX > minDistanceSquared)
+                        break;
+
+                    // ATTN Same floating point operations as (positionVector1 - positionVector2).GetMagnitudeSquared()
+                    const float deltaY(y1 - xOrderedY2[xIndex]), deltaZ(z1 - xOrderedZ2[xIndex]);
+                    const float distanceSquared(deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ);
+                    const unsigned int index2(xOrderedIndices2[xIndex]);
+
+                    if ((distanceSquared < minDistanceSquared) ||
+                        ((distanceSquared == minDistanceSquared) && (thisIndex1 == bestIndex1) && (index2 < bestIndex2)))
+                    {
+                        minDistanceSquared = distanceSquared;
+                        closestPosition1 = positionVector1;
+                        closestPosition2.SetValues(xOrderedX2[xIndex], xOrderedY2[xIndex], xOrderedZ2[xIndex]);
+                        bestIndex1 = thisIndex1;
+                        bestIndex2 = index2;
+                        distanceFound = true;
+                    }
+                }
+            }
+        }
+    }
+
+    if (!distanceFound)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    outputPosition1 = closestPosition1;
+    outputPosition2 = closestPosition2;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LArClusterHelper::GetClusterBoundingBox(const Cluster *const pCluster, CartesianVector &minimumCoordinate, CartesianVector &maximumCoordinate)
 {
     const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
@@ -403,7 +488,11 @@ void LArClusterHelper::GetExtremalCoordinates(const ClusterList &clusterList, Ca
 
 void LArClusterHelper::GetExtremalCoordinates(const Cluster *const pCluster, CartesianVector &innerCoordinate, CartesianVector &outerCoordinate)
 {
-    return LArClusterHelper::GetExtremalCoordinates(pCluster->GetOrderedCaloHitList(), innerCoordinate, outerCoordinate);
+    if (0 == pCluster->GetNCaloHits())
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return LArClusterHelper::GetExtremalCoordinates(
+        LArClusterHelper::GetClusterHitIndex(pCluster).GetSortedCoordinateVector(), innerCoordinate, outerCoordinate);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -537,6 +626,15 @@ void LArClusterHelper::GetExtremalCoordinates(const CartesianPointVector &coordi
 
 void LArClusterHelper::GetCoordinateVector(const Cluster *const pCluster, CartesianPointVector &coordinateVector)
 {
+    // ATTN The sorted coordinates can only be reused if there are no existing coordinates to be sorted alongside them
+    if (coordinateVector.empty())
+    {
+        if (pCluster->GetNCaloHits() > 0)
+            coordinateVector = LArClusterHelper::GetClusterHitIndex(pCluster).GetSortedCoordinateVector();
+
+        return;
+    }
+
     for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
     {
         for (const CaloHit *const pCaloHit : *layerEntry.second)
@@ -746,4 +844,127 @@ bool LArClusterHelper::SortCoordinatesByPosition(const CartesianVector &lhs, con
     return (deltaPosition.GetY() > std::numeric_limits<float>::epsilon());
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArClusterHelper::InvalidateClusterHitIndex(const Cluster *const pCluster)
+{
+    (void)LArClusterHelper::GetClusterHitIndexMap().erase(pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArClusterHelper::ResetClusterHitIndices()
+{
+    LArClusterHelper::GetClusterHitIndexMap().clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::ClusterHitIndex &LArClusterHelper::GetClusterHitIndex(const Cluster *const pCluster)
+{
+    ClusterHitIndexMap &clusterHitIndexMap(LArClusterHelper::GetClusterHitIndexMap());
+    ClusterHitIndexMap::iterator iter(clusterHitIndexMap.find(pCluster));
+
+    if (clusterHitIndexMap.end() != iter)
+        return iter->second;
+
+    return clusterHitIndexMap.emplace(pCluster, ClusterHitIndex(pCluster)).first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::ClusterHitIndexMap &LArClusterHelper::GetClusterHitIndexMap()
+{
+    // ATTN The cache is per thread, as several pandora instances may run concurrently. Indices are not validated against the cluster hits
+    // on use: modified and deleted clusters must be invalidated, and the cache reset after each event, by the thread that processed them.
+    // Each ParallelFor worker re-indexes the clusters it queries, and its entries are freed when it exits.
+    thread_local ClusterHitIndexMap clusterHitIndexMap;
+    return clusterHitIndexMap;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHelper::ClusterHitIndex::ClusterHitIndex(const Cluster *const pCluster) :
+    m_minimumCoordinate(0.f, 0.f, 0.f),
+    m_maximumCoordinate(0.f, 0.f, 0.f)
+{
+    const unsigned int nHits(pCluster->GetNCaloHits());
+    m_caloHitVector.reserve(nHits);
+    m_x.reserve(nHits);
+    m_y.reserve(nHits);
+    m_z.reserve(nHits);
+
+    float xmin(std::numeric_limits<float>::max()), ymin(std::numeric_limits<float>::max()), zmin(std::numeric_limits<float>::max());
+    float xmax(-std::numeric_limits<float>::max()), ymax(-std::numeric_limits<float>::max()), zmax(-std::numeric_limits<float>::max());
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+        {
+            const CartesianVector &position(pCaloHit->GetPositionVector());
+            m_caloHitVector.push_back(pCaloHit);
+            m_x.push_back(position.GetX());
+            m_y.push_back(position.GetY());
+            m_z.push_back(position.GetZ());
+
+            xmin = std::min(position.GetX(), xmin);
+            xmax = std::max(position.GetX(), xmax);
+            ymin = std::min(position.GetY(), ymin);
+            ymax = std::max(position.GetY(), ymax);
+            zmin = std::min(position.GetZ(), zmin);
+            zmax = std::max(position.GetZ(), zmax);
+        }
+    }
+
+    if (!m_caloHitVector.empty())
+    {
+        m_minimumCoordinate.SetValues(xmin, ymin, zmin);
+        m_maximumCoordinate.SetValues(xmax, ymax, zmax);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const std::vector<unsigned int> &LArClusterHelper::ClusterHitIndex::GetXOrderedIndices()
+{
+    if (m_xOrderedIndices.size() == m_caloHitVector.size())
+        return m_xOrderedIndices;
+
+    for (unsigned int index = 0; index < m_caloHitVector.size(); ++index)
+        m_xOrderedIndices.push_back(index);
+
+    std::stable_sort(m_xOrderedIndices.begin(), m_xOrderedIndices.end(),
+        [this](const unsigned int lhs, const unsigned int rhs) { return (m_x[lhs] < m_x[rhs]); });
+
+    m_xOrderedX.reserve(m_xOrderedIndices.size());
+    m_xOrderedY.reserve(m_xOrderedIndices.size());
+    m_xOrderedZ.reserve(m_xOrderedIndices.size());
+
+    for (const unsigned int index : m_xOrderedIndices)
+    {
+        m_xOrderedX.push_back(m_x[index]);
+        m_xOrderedY.push_back(m_y[index]);
+        m_xOrderedZ.push_back(m_z[index]);
+    }
+
+    return m_xOrderedIndices;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const CartesianPointVector &LArClusterHelper::ClusterHitIndex::GetSortedCoordinateVector()
+{
+    if (m_sortedCoordinateVector.size() == m_caloHitVector.size())
+        return m_sortedCoordinateVector;
+
+    m_sortedCoordinateVector.reserve(m_caloHitVector.size());
+
+    for (unsigned int index = 0; index < m_caloHitVector.size(); ++index)
+        m_sortedCoordinateVector.push_back(CartesianVector(m_x[index], m_y[index], m_z[index]));
+
+    std::sort(m_sortedCoordinateVector.begin(), m_sortedCoordinateVector.end(), LArClusterHelper::SortCoordinatesByPosition);
+    return m_sortedCoordinateVector;
+}
+
 } // namespace lar_content
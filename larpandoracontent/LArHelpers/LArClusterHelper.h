@@ -10,6 +10,9 @@
 
 #include "Objects/Cluster.h"
 
+#include <unordered_map>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -354,6 +357,94 @@ public:
      *  @param  rhs second point
      */
     static bool SortCoordinatesByPosition(const pandora::CartesianVector &lhs, const pandora::CartesianVector &rhs);
+
+    /**
+     *  @brief  Drop the hit index for a cluster, built by this thread, to be called whenever hits are added to or removed from the cluster,
+     *          including by merging, and whenever the cluster is deleted
+     *
+     *  @param  pCluster address of the cluster
+     */
+    static void InvalidateClusterHitIndex(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Drop all hit indices built by this thread, to be called after each event, so that no index outlives its clusters and hits
+     */
+    static void ResetClusterHitIndices();
+
+private:
+    /**
+     *  @brief  ClusterHitIndex class, holding the hits of a cluster in ordered calo hit list order together with contiguous copies of their
+     *          coordinates, so that repeated geometry queries need not revisit the individual hits. The ordering of the hits in x and
+     *          by position are only calculated on first request.
+     */
+    class ClusterHitIndex
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster address of the cluster
+         */
+        ClusterHitIndex(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Get the indices of the cluster hits, sorted by x coordinate, together with their sorted coordinates
+         *
+         *  @return the indices of the cluster hits, sorted by x coordinate
+         */
+        const std::vector<unsigned int> &GetXOrderedIndices();
+
+        /**
+         *  @brief  Get the hit coordinates, sorted by position as in GetCoordinateVector
+         *
+         *  @return the sorted hit coordinates
+         */
+        const pandora::CartesianPointVector &GetSortedCoordinateVector();
+
+        pandora::CaloHitVector m_caloHitVector;                 ///< The cluster hits, in ordered calo hit list order
+        pandora::FloatVector m_x;                               ///< The x coordinates of the cluster hits, in ordered calo hit list order
+        pandora::FloatVector m_y;                               ///< The y coordinates of the cluster hits, in ordered calo hit list order
+        pandora::FloatVector m_z;                               ///< The z coordinates of the cluster hits, in ordered calo hit list order
+        std::vector<unsigned int> m_xOrderedIndices;            ///< The indices of the cluster hits, sorted by x coordinate
+        pandora::FloatVector m_xOrderedX;                       ///< The x coordinates of the cluster hits, sorted by x coordinate
+        pandora::FloatVector m_xOrderedY;                       ///< The y coordinates of the cluster hits, sorted by x coordinate
+        pandora::FloatVector m_xOrderedZ;                       ///< The z coordinates of the cluster hits, sorted by x coordinate
+        pandora::CartesianPointVector m_sortedCoordinateVector; ///< The hit coordinates, sorted by position
+        pandora::CartesianVector m_minimumCoordinate;           ///< The minimum coordinates of the cluster hits
+        pandora::CartesianVector m_maximumCoordinate;           ///< The maximum coordinates of the cluster hits
+    };
+
+    typedef std::unordered_map<const pandora::Cluster *, ClusterHitIndex> ClusterHitIndexMap;
+
+    /**
+     *  @brief  Get the hit index for a cluster, from a per-thread cache, building the index on first request. Clusters are not
+     *          associated with a pandora instance here, and are modified by the thread processing them, so the cache is not shared.
+     *          Threads started by LArThreadHelper::ParallelFor therefore build their own indices, which are discarded when they exit.
+     *
+     *  @param  pCluster address of the cluster
+     *
+     *  @return the hit index, which remains valid until the cluster hit index is invalidated or reset
+     */
+    static ClusterHitIndex &GetClusterHitIndex(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Get the hit index cache for this thread
+     *
+     *  @return the hit index cache
+     */
+    static ClusterHitIndexMap &GetClusterHitIndexMap();
+
+    /**
+     *  @brief  Get pair of closest positions for a pair of clusters, using the hit index of the second cluster to avoid examining all
+     *          hit pairs. The result is identical to that of the direct comparison of all hit pairs.
+     *
+     *  @param  pCluster1 the address of the first cluster
+     *  @param  pCluster2 the address of the second cluster
+     *  @param  the closest position in the first cluster
+     *  @param  the closest position in the second cluster
+     */
+    static void GetClosestPositionsUsingIndex(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2,
+        pandora::CartesianVector &position1, pandora::CartesianVector &position2);
 };
 
 } // namespace lar_content
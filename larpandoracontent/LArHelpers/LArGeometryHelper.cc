@@ -23,6 +23,9 @@
 
 #include "Plugins/LArTransformationPlugin.h"
 
+#include <algorithm>
+#include <cmath>
+
 using namespace pandora;
 
 namespace lar_content
@@ -378,29 +381,23 @@ float LArGeometryHelper::GetWirePitch(const Pandora &pandora, const HitType view
     if (view != TPC_VIEW_U && view != TPC_VIEW_V && view != TPC_VIEW_W)
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-    const LArTPCMap &larTPCMap(pandora.GetGeometry()->GetLArTPCMap());
+    const GeometryConstants &geometryConstants(LArGeometryHelper::GetInstanceGeometry(pandora).m_geometryConstants);
 
-    if (larTPCMap.empty())
+    if (0 == geometryConstants.m_nLArTPCs)
     {
         std::cout << "LArGeometryHelper::GetWirePitch - LArTPC description not registered with Pandora as required " << std::endl;
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
     }
 
-    const LArTPC *const pFirstLArTPC(larTPCMap.begin()->second);
-    const float wirePitch(view == TPC_VIEW_U ? pFirstLArTPC->GetWirePitchU()
-                                             : (view == TPC_VIEW_V ? pFirstLArTPC->GetWirePitchV() : pFirstLArTPC->GetWirePitchW()));
+    const float wirePitch(view == TPC_VIEW_U ? geometryConstants.m_wirePitchU
+                                             : (view == TPC_VIEW_V ? geometryConstants.m_wirePitchV : geometryConstants.m_wirePitchW));
+    const float wirePitchDiscrepancy(view == TPC_VIEW_U ? geometryConstants.m_maxWirePitchDiscrepancyU
+            : (view == TPC_VIEW_V ? geometryConstants.m_maxWirePitchDiscrepancyV : geometryConstants.m_maxWirePitchDiscrepancyW));
 
-    for (const LArTPCMap::value_type &mapEntry : larTPCMap)
+    if (wirePitchDiscrepancy > maxWirePitchDiscrepancy)
     {
-        const LArTPC *const pLArTPC(mapEntry.second);
-        const float alternateWirePitch(
-            view == TPC_VIEW_U ? pLArTPC->GetWirePitchU() : (view == TPC_VIEW_V ? pLArTPC->GetWirePitchV() : pLArTPC->GetWirePitchW()));
-
-        if (std::fabs(wirePitch - alternateWirePitch) > maxWirePitchDiscrepancy)
-        {
-            std::cout << "LArGeometryHelper::GetWirePitch - LArTPC configuration not supported" << std::endl;
-            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
-        }
+        std::cout << "LArGeometryHelper::GetWirePitch - LArTPC configuration not supported" << std::endl;
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
     }
 
     return wirePitch;
@@ -410,6 +407,20 @@ float LArGeometryHelper::GetWirePitch(const Pandora &pandora, const HitType view
 
 CartesianVector LArGeometryHelper::GetWireAxis(const Pandora &pandora, const HitType view)
 {
+    const GeometryConstants &geometryConstants(LArGeometryHelper::GetInstanceGeometry(pandora).m_geometryConstants);
+
+    if (geometryConstants.m_hasWireAxes)
+    {
+        if (view == TPC_VIEW_U)
+            return geometryConstants.m_wireAxisU;
+
+        if (view == TPC_VIEW_V)
+            return geometryConstants.m_wireAxisV;
+
+        if (view == TPC_VIEW_W)
+            return geometryConstants.m_wireAxisW;
+    }
+
     if (view == TPC_VIEW_U)
     {
         return CartesianVector(0.f, pandora.GetPlugins()->GetLArTransformationPlugin()->YZtoU(1.f, 0.f),
@@ -449,6 +460,12 @@ void LArGeometryHelper::GetCommonDaughterVolumes(const Cluster *const pCluster1,
 bool LArGeometryHelper::IsInGap(const Pandora &pandora, const CartesianVector &testPoint2D, const HitType hitType, const float gapTolerance)
 {
     // ATTN: input test point MUST be a 2D position vector
+    if (((TPC_VIEW_U == hitType) || (TPC_VIEW_V == hitType) || (TPC_VIEW_W == hitType)) && std::isfinite(testPoint2D.GetX()) &&
+        std::isfinite(testPoint2D.GetZ()))
+    {
+        return LArGeometryHelper::GetInstanceGeometry(pandora).m_detectorGapIndex.IsInGap(testPoint2D, hitType, gapTolerance);
+    }
+
     for (const DetectorGap *const pDetectorGap : pandora.GetGeometry()->GetDetectorGapList())
     {
         if (pDetectorGap->IsInGap(testPoint2D, hitType, gapTolerance))
@@ -511,23 +528,294 @@ float LArGeometryHelper::CalculateGapDeltaZ(const Pandora &pandora, const float
     if (maxZ - minZ < std::numeric_limits<float>::epsilon())
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-    float gapDeltaZ(0.f);
+    return LArGeometryHelper::GetInstanceGeometry(pandora).m_detectorGapIndex.CalculateGapDeltaZ(minZ, maxZ, hitType);
+}
 
-    for (const DetectorGap *const pDetectorGap : pandora.GetGeometry()->GetDetectorGapList())
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArGeometryHelper::GetSigmaUVW(const Pandora &pandora, const float maxSigmaDiscrepancy)
+{
+    const GeometryConstants &geometryConstants(LArGeometryHelper::GetInstanceGeometry(pandora).m_geometryConstants);
+
+    if (0 == geometryConstants.m_nLArTPCs)
     {
-        const LineGap *const pLineGap = dynamic_cast<const LineGap *>(pDetectorGap);
+        std::cout << "LArGeometryHelper::GetSigmaUVW - LArTPC description not registered with Pandora as required " << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+    }
+
+    if (geometryConstants.m_maxSigmaDiscrepancy > maxSigmaDiscrepancy)
+    {
+        std::cout << "LArGeometryHelper::GetSigmaUVW - Plugin does not support provided LArTPC configurations " << std::endl;
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    }
+
+    return geometryConstants.m_sigmaUVW;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArGeometryHelper::ReleaseGeometry(const Pandora &pandora)
+{
+    InstanceGeometryStore &store(LArGeometryHelper::GetInstanceGeometryStore());
+    std::lock_guard<std::mutex> lock(store.m_mutex);
+
+    const InstanceGeometryMap *const pInstanceGeometryMap(store.m_pInstanceGeometryMap.load(std::memory_order_relaxed));
+
+    if (!pInstanceGeometryMap->count(&pandora))
+        return;
+
+    std::unique_ptr<InstanceGeometryMap> pNewInstanceGeometryMap(std::make_unique<InstanceGeometryMap>(*pInstanceGeometryMap));
+    pNewInstanceGeometryMap->erase(&pandora);
+    LArGeometryHelper::PublishInstanceGeometryMap(store, std::move(pNewInstanceGeometryMap));
+}
+
+// private
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArGeometryHelper::InstanceGeometry &LArGeometryHelper::GetInstanceGeometry(const Pandora &pandora)
+{
+    const InstanceGeometryMap *const pInstanceGeometryMap(
+        LArGeometryHelper::GetInstanceGeometryStore().m_pInstanceGeometryMap.load(std::memory_order_acquire));
+    InstanceGeometryMap::const_iterator iter(pInstanceGeometryMap->find(&pandora));
+
+    if (pInstanceGeometryMap->end() != iter)
+        return *(iter->second);
+
+    return LArGeometryHelper::AddInstanceGeometry(pandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArGeometryHelper::InstanceGeometry &LArGeometryHelper::AddInstanceGeometry(const Pandora &pandora)
+{
+    InstanceGeometryStore &store(LArGeometryHelper::GetInstanceGeometryStore());
+    std::lock_guard<std::mutex> lock(store.m_mutex);
+
+    const InstanceGeometryMap *const pInstanceGeometryMap(store.m_pInstanceGeometryMap.load(std::memory_order_relaxed));
+    InstanceGeometryMap::const_iterator iter(pInstanceGeometryMap->find(&pandora));
+
+    if (pInstanceGeometryMap->end() != iter)
+        return *(iter->second);
+
+    std::shared_ptr<const InstanceGeometry> pInstanceGeometry(std::make_shared<const InstanceGeometry>(pandora));
+    std::unique_ptr<InstanceGeometryMap> pNewInstanceGeometryMap(std::make_unique<InstanceGeometryMap>(*pInstanceGeometryMap));
+    (*pNewInstanceGeometryMap)[&pandora] = pInstanceGeometry;
+    LArGeometryHelper::PublishInstanceGeometryMap(store, std::move(pNewInstanceGeometryMap));
+
+    return *pInstanceGeometry;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArGeometryHelper::PublishInstanceGeometryMap(
+    InstanceGeometryStore &store, std::unique_ptr<const InstanceGeometryMap> pInstanceGeometryMap)
+{
+    // ATTN Maps are never freed, as a reader may still be using an earlier map. Maps are only published when an instance is first queried
+    // or released, so the number retained is bounded by twice the number of pandora instances created by the process.
+    store.m_pInstanceGeometryMap.store(pInstanceGeometryMap.get(), std::memory_order_release);
+    store.m_instanceGeometryMaps.push_back(std::move(pInstanceGeometryMap));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArGeometryHelper::InstanceGeometryStore &LArGeometryHelper::GetInstanceGeometryStore()
+{
+    static InstanceGeometryStore instanceGeometryStore;
+    return instanceGeometryStore;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArGeometryHelper::InstanceGeometryStore::InstanceGeometryStore() :
+    m_pInstanceGeometryMap(nullptr)
+{
+    m_instanceGeometryMaps.push_back(std::make_unique<const InstanceGeometryMap>());
+    m_pInstanceGeometryMap.store(m_instanceGeometryMaps.back().get(), std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArGeometryHelper::InstanceGeometry::InstanceGeometry(const Pandora &pandora) :
+    m_geometryConstants(pandora),
+    m_detectorGapIndex(pandora.GetGeometry()->GetDetectorGapList())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArGeometryHelper::GeometryConstants::GeometryConstants(const Pandora &pandora) :
+    m_nLArTPCs(pandora.GetGeometry()->GetLArTPCMap().size()),
+    m_wirePitchU(0.f),
+    m_wirePitchV(0.f),
+    m_wirePitchW(0.f),
+    m_maxWirePitchDiscrepancyU(0.f),
+    m_maxWirePitchDiscrepancyV(0.f),
+    m_maxWirePitchDiscrepancyW(0.f),
+    m_sigmaUVW(0.f),
+    m_maxSigmaDiscrepancy(0.f),
+    m_hasWireAxes(false),
+    m_wireAxisU(0.f, 0.f, 0.f),
+    m_wireAxisV(0.f, 0.f, 0.f),
+    m_wireAxisW(0.f, 0.f, 0.f)
+{
+    const LArTPCMap &larTPCMap(pandora.GetGeometry()->GetLArTPCMap());
+
+    if (!larTPCMap.empty())
+    {
+        const LArTPC *const pFirstLArTPC(larTPCMap.begin()->second);
+        m_wirePitchU = pFirstLArTPC->GetWirePitchU();
+        m_wirePitchV = pFirstLArTPC->GetWirePitchV();
+        m_wirePitchW = pFirstLArTPC->GetWirePitchW();
+        m_sigmaUVW = pFirstLArTPC->GetSigmaUVW();
+    }
+
+    // ATTN Only the largest discrepancy need be stored, as the helper functions reject a configuration if any LArTPC differs from the
+    // first by more than the requested tolerance
+    for (const LArTPCMap::value_type &mapEntry : larTPCMap)
+    {
+        const LArTPC *const pLArTPC(mapEntry.second);
+        m_maxWirePitchDiscrepancyU = std::max(m_maxWirePitchDiscrepancyU, std::fabs(m_wirePitchU - pLArTPC->GetWirePitchU()));
+        m_maxWirePitchDiscrepancyV = std::max(m_maxWirePitchDiscrepancyV, std::fabs(m_wirePitchV - pLArTPC->GetWirePitchV()));
+        m_maxWirePitchDiscrepancyW = std::max(m_maxWirePitchDiscrepancyW, std::fabs(m_wirePitchW - pLArTPC->GetWirePitchW()));
+        m_maxSigmaDiscrepancy = std::max(m_maxSigmaDiscrepancy, std::fabs(m_sigmaUVW - pLArTPC->GetSigmaUVW()));
+    }
+
+    try
+    {
+        const LArTransformationPlugin *const pTransformationPlugin(pandora.GetPlugins()->GetLArTransformationPlugin());
+        m_wireAxisU = CartesianVector(0.f, pTransformationPlugin->YZtoU(1.f, 0.f), pTransformationPlugin->YZtoU(0.f, 1.f));
+        m_wireAxisV = CartesianVector(0.f, pTransformationPlugin->YZtoV(1.f, 0.f), pTransformationPlugin->YZtoV(0.f, 1.f));
+        m_wireAxisW = CartesianVector(0.f, pTransformationPlugin->YZtoW(1.f, 0.f), pTransformationPlugin->YZtoW(0.f, 1.f));
+        m_hasWireAxes = true;
+    }
+    catch (const StatusCodeException &)
+    {
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArGeometryHelper::DetectorGapIndex::DetectorGapIndex(const DetectorGapList &detectorGapList) :
+    m_allLineGaps(true)
+{
+    unsigned int gapListIndex(0);
+
+    for (const DetectorGap *const pDetectorGap : detectorGapList)
+    {
+        const LineGap *const pLineGap(dynamic_cast<const LineGap *>(pDetectorGap));
+        GapIntervalVector *pGapIntervals(nullptr);
+        bool isDriftGap(false);
 
         if (!pLineGap)
-            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+        {
+            m_allLineGaps = false;
+        }
+        else
+        {
+            const LineGapType lineGapType(pLineGap->GetLineGapType());
+
+            if (TPC_WIRE_GAP_VIEW_U == lineGapType)
+                pGapIntervals = &m_wireGapsU;
+            else if (TPC_WIRE_GAP_VIEW_V == lineGapType)
+                pGapIntervals = &m_wireGapsV;
+            else if (TPC_WIRE_GAP_VIEW_W == lineGapType)
+                pGapIntervals = &m_wireGapsW;
+            else if (TPC_DRIFT_GAP == lineGapType)
+                pGapIntervals = &m_driftGaps;
+
+            isDriftGap = (TPC_DRIFT_GAP == lineGapType);
+        }
 
-        const LineGapType lineGapType(pLineGap->GetLineGapType());
+        if (!pGapIntervals)
+        {
+            m_otherGaps.push_back(pDetectorGap);
+        }
+        else
+        {
+            const float lineStart(isDriftGap ? pLineGap->GetLineStartX() : pLineGap->GetLineStartZ());
+            const float lineEnd(isDriftGap ? pLineGap->GetLineEndX() : pLineGap->GetLineEndZ());
+
+            GapInterval gapInterval;
+            gapInterval.m_pLineGap = pLineGap;
+            gapInterval.m_gapListIndex = gapListIndex;
+            gapInterval.m_min = std::min(lineStart, lineEnd);
+            gapInterval.m_max = std::max(lineStart, lineEnd);
+            gapInterval.m_maxOfMax = gapInterval.m_max;
+            pGapIntervals->push_back(gapInterval);
+        }
 
-        if (!(((TPC_VIEW_U == hitType) && (TPC_WIRE_GAP_VIEW_U == lineGapType)) || ((TPC_VIEW_V == hitType) && (TPC_WIRE_GAP_VIEW_V == lineGapType)) ||
-                ((TPC_VIEW_W == hitType) && (TPC_WIRE_GAP_VIEW_W == lineGapType))))
+        ++gapListIndex;
+    }
+
+    for (GapIntervalVector *const pGapIntervals : {&m_wireGapsU, &m_wireGapsV, &m_wireGapsW, &m_driftGaps})
+    {
+        std::stable_sort(pGapIntervals->begin(), pGapIntervals->end(),
+            [](const GapInterval &lhs, const GapInterval &rhs) -> bool { return (lhs.m_min < rhs.m_min); });
+
+        for (unsigned int iGap = 1; iGap < pGapIntervals->size(); ++iGap)
+            pGapIntervals->at(iGap).m_maxOfMax = std::max(pGapIntervals->at(iGap).m_max, pGapIntervals->at(iGap - 1).m_maxOfMax);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArGeometryHelper::DetectorGapIndex::IsInGap(const CartesianVector &testPoint2D, const HitType hitType, const float gapTolerance) const
+{
+    for (const DetectorGap *const pDetectorGap : m_otherGaps)
+    {
+        if (pDetectorGap->IsInGap(testPoint2D, hitType, gapTolerance))
+            return true;
+    }
+
+    const GapIntervalVector *const pWireGaps(this->GetWireGaps(hitType));
+
+    if (!pWireGaps)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    // ATTN The candidate ranges are widened beyond the gap tolerance, to allow for rounding in the line gap comparisons, which make the
+    // final decision for each candidate gap
+    auto isInCandidateGap = [&](const GapIntervalVector &gapIntervals, const float coordinate) -> bool {
+        const float searchTolerance(std::fabs(gapTolerance) + 1.e-4f * (1.f + std::fabs(coordinate) + std::fabs(gapTolerance)));
+        std::vector<unsigned int> gapIntervalIndices;
+        this->FindGapIntervals(gapIntervals, coordinate - searchTolerance, coordinate + searchTolerance, gapIntervalIndices);
+
+        for (const unsigned int gapIntervalIndex : gapIntervalIndices)
         {
-            continue;
+            if (gapIntervals.at(gapIntervalIndex).m_pLineGap->IsInGap(testPoint2D, hitType, gapTolerance))
+                return true;
         }
 
+        return false;
+    };
+
+    return (isInCandidateGap(*pWireGaps, testPoint2D.GetZ()) || isInCandidateGap(m_driftGaps, testPoint2D.GetX()));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArGeometryHelper::DetectorGapIndex::CalculateGapDeltaZ(const float minZ, const float maxZ, const HitType hitType) const
+{
+    if (!m_allLineGaps)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const GapIntervalVector *const pWireGaps(this->GetWireGaps(hitType));
+
+    if (!pWireGaps)
+        return 0.f;
+
+    std::vector<unsigned int> gapIntervalIndices;
+    this->FindGapIntervals(*pWireGaps, minZ, maxZ, gapIntervalIndices);
+
+    float gapDeltaZ(0.f);
+
+    for (const unsigned int gapIntervalIndex : gapIntervalIndices)
+    {
+        const LineGap *const pLineGap(pWireGaps->at(gapIntervalIndex).m_pLineGap);
+
         if ((pLineGap->GetLineStartZ() > maxZ) || (pLineGap->GetLineEndZ() < minZ))
             continue;
 
@@ -543,31 +831,44 @@ float LArGeometryHelper::CalculateGapDeltaZ(const Pandora &pandora, const float
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-float LArGeometryHelper::GetSigmaUVW(const Pandora &pandora, const float maxSigmaDiscrepancy)
+const LArGeometryHelper::DetectorGapIndex::GapIntervalVector *LArGeometryHelper::DetectorGapIndex::GetWireGaps(const HitType hitType) const
 {
-    const LArTPCMap &larTPCMap(pandora.GetGeometry()->GetLArTPCMap());
+    if (TPC_VIEW_U == hitType)
+        return &m_wireGapsU;
 
-    if (larTPCMap.empty())
-    {
-        std::cout << "LArGeometryHelper::GetSigmaUVW - LArTPC description not registered with Pandora as required " << std::endl;
-        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
-    }
+    if (TPC_VIEW_V == hitType)
+        return &m_wireGapsV;
 
-    const LArTPC *const pFirstLArTPC(larTPCMap.begin()->second);
-    const float sigmaUVW(pFirstLArTPC->GetSigmaUVW());
+    if (TPC_VIEW_W == hitType)
+        return &m_wireGapsW;
 
-    for (const LArTPCMap::value_type &mapEntry : larTPCMap)
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArGeometryHelper::DetectorGapIndex::FindGapIntervals(const GapIntervalVector &gapIntervals, const float minCoordinate,
+    const float maxCoordinate, std::vector<unsigned int> &gapIntervalIndices) const
+{
+    // Intervals are sorted by minimum coordinate, so only those up to the last starting before maxCoordinate are candidates, and the
+    // running maximum identifies the point before which no interval can reach minCoordinate
+    GapIntervalVector::const_iterator iter(std::upper_bound(gapIntervals.begin(), gapIntervals.end(), maxCoordinate,
+        [](const float coordinate, const GapInterval &gapInterval) -> bool { return (coordinate < gapInterval.m_min); }));
+
+    while (gapIntervals.begin() != iter)
     {
-        const LArTPC *const pLArTPC(mapEntry.second);
+        --iter;
 
-        if (std::fabs(sigmaUVW - pLArTPC->GetSigmaUVW()) > maxSigmaDiscrepancy)
-        {
-            std::cout << "LArGeometryHelper::GetSigmaUVW - Plugin does not support provided LArTPC configurations " << std::endl;
-            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
-        }
+        if (iter->m_maxOfMax < minCoordinate)
+            break;
+
+        if (!(iter->m_max < minCoordinate))
+            gapIntervalIndices.push_back(iter - gapIntervals.begin());
     }
 
-    return sigmaUVW;
+    std::sort(gapIntervalIndices.begin(), gapIntervalIndices.end(),
+        [&gapIntervals](const unsigned int lhs, const unsigned int rhs) -> bool
+        { return (gapIntervals[lhs].m_gapListIndex < gapIntervals[rhs].m_gapListIndex); });
 }
 
 } // namespace lar_content
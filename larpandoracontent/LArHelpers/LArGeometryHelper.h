@@ -8,14 +8,21 @@
 #ifndef LAR_GEOMETRY_HELPER_H
 #define LAR_GEOMETRY_HELPER_H 1
 
+#include "Objects/CartesianVector.h"
+
 #include "Pandora/PandoraEnumeratedTypes.h"
+#include "Pandora/PandoraInternal.h"
 #include "Pandora/StatusCodes.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace pandora
 {
-class CartesianVector;
+class LineGap;
 class Pandora;
 } // namespace pandora
 
@@ -266,6 +273,195 @@ public:
      *  @param  pCluster2 the second cluster
      */
     static void GetCommonDaughterVolumes(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, UIntSet &intersect);
+
+    /**
+     *  @brief  Release the geometry quantities derived for a pandora instance, so that they cannot reach a later instance created at the
+     *          same address. Quantities are derived on the first request for an instance, so must be released before it is destroyed;
+     *          LArRotationalTransformationPlugin does so on destruction, otherwise the client application must call this function.
+     *
+     *  @param  pandora the associated pandora instance
+     */
+    static void ReleaseGeometry(const pandora::Pandora &pandora);
+
+private:
+    /**
+     *  @brief  GeometryConstants class, holding quantities derived from the registered LArTPCs and the transformation plugin
+     */
+    class GeometryConstants
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pandora the associated pandora instance
+         */
+        GeometryConstants(const pandora::Pandora &pandora);
+
+        unsigned int m_nLArTPCs;              ///< The number of registered LArTPCs
+        float m_wirePitchU;                   ///< The u wire pitch of the first LArTPC
+        float m_wirePitchV;                   ///< The v wire pitch of the first LArTPC
+        float m_wirePitchW;                   ///< The w wire pitch of the first LArTPC
+        float m_maxWirePitchDiscrepancyU;     ///< The largest difference between the u wire pitches of the first and any other LArTPC
+        float m_maxWirePitchDiscrepancyV;     ///< The largest difference between the v wire pitches of the first and any other LArTPC
+        float m_maxWirePitchDiscrepancyW;     ///< The largest difference between the w wire pitches of the first and any other LArTPC
+        float m_sigmaUVW;                     ///< The sigmaUVW value of the first LArTPC
+        float m_maxSigmaDiscrepancy;          ///< The largest difference between the sigmaUVW values of the first and any other LArTPC
+        bool m_hasWireAxes;                   ///< Whether the wire axes could be obtained from the transformation plugin
+        pandora::CartesianVector m_wireAxisU; ///< The u wire axis
+        pandora::CartesianVector m_wireAxisV; ///< The v wire axis
+        pandora::CartesianVector m_wireAxisW; ///< The w wire axis
+    };
+
+    /**
+     *  @brief  DetectorGapIndex class, holding the wire gaps for each view sorted by z and the drift gaps sorted by x, so that gap queries
+     *          need only consider the gaps close to the query position. Gaps of other types are always considered.
+     */
+    class DetectorGapIndex
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  detectorGapList the detector gap list
+         */
+        DetectorGapIndex(const pandora::DetectorGapList &detectorGapList);
+
+        /**
+         *  @brief  Whether a 2D test point lies in a registered gap with the associated hit type
+         *
+         *  @param  testPoint2D the test point
+         *  @param  hitType the hit type
+         *  @param  gapTolerance the gap tolerance
+         *
+         *  @return boolean
+         */
+        bool IsInGap(const pandora::CartesianVector &testPoint2D, const pandora::HitType hitType, const float gapTolerance) const;
+
+        /**
+         *  @brief  Calculate the total distance within a given 2D region that is composed of detector gaps
+         *
+         *  @param  minZ the start position in Z
+         *  @param  maxZ the end position in Z
+         *  @param  hitType the hit type
+         *
+         *  @return the total distance in gaps
+         */
+        float CalculateGapDeltaZ(const float minZ, const float maxZ, const pandora::HitType hitType) const;
+
+    private:
+        /**
+         *  @brief  GapInterval class, describing the extent of a line gap along the coordinate by which it is indexed
+         */
+        class GapInterval
+        {
+        public:
+            const pandora::LineGap *m_pLineGap; ///< The address of the line gap
+            unsigned int m_gapListIndex;        ///< The position of the gap in the detector gap list
+            float m_min;                        ///< The smaller of the line start and end coordinates
+            float m_max;                        ///< The larger of the line start and end coordinates
+            float m_maxOfMax;                   ///< The largest maximum coordinate of this and all preceding intervals
+        };
+
+        typedef std::vector<GapInterval> GapIntervalVector;
+
+        /**
+         *  @brief  Get the wire gaps for a given hit type
+         *
+         *  @param  hitType the hit type
+         *
+         *  @return the address of the wire gaps, or nullptr if the hit type is not a wire view
+         */
+        const GapIntervalVector *GetWireGaps(const pandora::HitType hitType) const;
+
+        /**
+         *  @brief  Find the gap intervals that may overlap a given coordinate range, in the order of the detector gap list
+         *
+         *  @param  gapIntervals the gap intervals, sorted by minimum coordinate
+         *  @param  minCoordinate the minimum coordinate
+         *  @param  maxCoordinate the maximum coordinate
+         *  @param  gapIntervalIndices to receive the positions of the candidate intervals within the gap interval vector
+         */
+        void FindGapIntervals(const GapIntervalVector &gapIntervals, const float minCoordinate, const float maxCoordinate,
+            std::vector<unsigned int> &gapIntervalIndices) const;
+
+        bool m_allLineGaps;                   ///< Whether all detector gaps are line gaps
+        pandora::DetectorGapList m_otherGaps; ///< The detector gaps that are neither wire nor drift gaps, checked for all queries
+        GapIntervalVector m_wireGapsU;        ///< The u view wire gaps, sorted by minimum z coordinate
+        GapIntervalVector m_wireGapsV;        ///< The v view wire gaps, sorted by minimum z coordinate
+        GapIntervalVector m_wireGapsW;        ///< The w view wire gaps, sorted by minimum z coordinate
+        GapIntervalVector m_driftGaps;        ///< The drift gaps, sorted by minimum x coordinate
+    };
+
+    /**
+     *  @brief  InstanceGeometry class, holding the geometry quantities derived for a single pandora instance
+     */
+    class InstanceGeometry
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pandora the associated pandora instance
+         */
+        InstanceGeometry(const pandora::Pandora &pandora);
+
+        const GeometryConstants m_geometryConstants; ///< The geometry constants
+        const DetectorGapIndex m_detectorGapIndex;   ///< The detector gap index
+    };
+
+    typedef std::unordered_map<const pandora::Pandora *, std::shared_ptr<const InstanceGeometry>> InstanceGeometryMap;
+    typedef std::vector<std::unique_ptr<const InstanceGeometryMap>> InstanceGeometryMapVector;
+
+    /**
+     *  @brief  InstanceGeometryStore class, holding the derived geometry quantities for all pandora instances in the process. Readers use
+     *          the current map without locking. Writers publish a modified copy, retaining earlier maps as readers may still be using them.
+     */
+    class InstanceGeometryStore
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        InstanceGeometryStore();
+
+        std::mutex m_mutex;                                              ///< The mutex serialising writers
+        std::atomic<const InstanceGeometryMap *> m_pInstanceGeometryMap; ///< The current map of derived geometry quantities
+        InstanceGeometryMapVector m_instanceGeometryMaps;                ///< All maps published so far, owning the current and earlier maps
+    };
+
+    /**
+     *  @brief  Get the geometry quantities for a pandora instance, deriving them on the first request. The instance geometry must be fully
+     *          registered, and its transformation plugin initialized, before the first request
+     *
+     *  @param  pandora the associated pandora instance
+     *
+     *  @return the geometry quantities, valid for the lifetime of the process
+     */
+    static const InstanceGeometry &GetInstanceGeometry(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Derive and store the geometry quantities for a pandora instance, unless another thread has already done so
+     *
+     *  @param  pandora the associated pandora instance
+     *
+     *  @return the geometry quantities, valid for the lifetime of the process
+     */
+    static const InstanceGeometry &AddInstanceGeometry(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Publish a new map of derived geometry quantities, to be called with the store mutex locked
+     *
+     *  @param  store the store
+     *  @param  pInstanceGeometryMap the new map
+     */
+    static void PublishInstanceGeometryMap(InstanceGeometryStore &store, std::unique_ptr<const InstanceGeometryMap> pInstanceGeometryMap);
+
+    /**
+     *  @brief  Get the process-wide store of derived geometry quantities
+     *
+     *  @return the store
+     */
+    static InstanceGeometryStore &GetInstanceGeometryStore();
 };
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -651,58 +651,129 @@ void LArMCParticleHelper::GetPfoMCParticleHitSharingMaps(const PfoContributionMa
         sortedPfos.push_back(mapEntry.first);
     std::sort(sortedPfos.begin(), sortedPfos.end(), LArPfoHelper::SortByNHits);
 
+    if (sortedPfos.empty())
+        return;
+
+    // Index the selected MCParticles, in the order in which Pfo sharing records are to be considered, and their reconstructable hits
+    MCParticleVector sortedMCParticles;
+    for (const MCContributionMap &mcParticleToHitsMap : selectedMCParticleToHitsMaps)
+    {
+        MCParticleVector mapMCParticles;
+        for (const auto &mapEntry : mcParticleToHitsMap)
+            mapMCParticles.push_back(mapEntry.first);
+        std::sort(mapMCParticles.begin(), mapMCParticles.end(), PointerLessThan<MCParticle>());
+        sortedMCParticles.insert(sortedMCParticles.end(), mapMCParticles.begin(), mapMCParticles.end());
+    }
+
+    if (sortedMCParticles.empty())
+        return;
+
+    // ATTN An MCParticle may appear in more than one selected map; record the last index at which each MCParticle appears
+    std::unordered_map<const MCParticle *, unsigned int> mcParticleToLastIndexMap;
+    for (unsigned int index = 0; index < sortedMCParticles.size(); ++index)
+        mcParticleToLastIndexMap[sortedMCParticles.at(index)] = index;
+
+    // Existing entries in the output maps are extended, but records for a Pfo and MCParticle pairing must not already be present
     for (const ParticleFlowObject *const pPfo : sortedPfos)
     {
-        for (const MCContributionMap &mcParticleToHitsMap : selectedMCParticleToHitsMaps)
+        PfoToMCParticleHitSharingMap::const_iterator iter(pfoToMCParticleHitSharingMap.find(pPfo));
+
+        if (pfoToMCParticleHitSharingMap.end() == iter)
+            continue;
+
+        for (const MCParticleCaloHitListPair &mcHitPair : iter->second)
         {
-            MCParticleVector sortedMCParticles;
-            for (const auto &mapEntry : mcParticleToHitsMap)
-                sortedMCParticles.push_back(mapEntry.first);
-            std::sort(sortedMCParticles.begin(), sortedMCParticles.end(), PointerLessThan<MCParticle>());
+            if (mcParticleToLastIndexMap.count(mcHitPair.first))
+                throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+        }
+    }
+
+    for (const auto &mapEntry : mcParticleToLastIndexMap)
+    {
+        MCParticleToPfoHitSharingMap::const_iterator iter(mcParticleToPfoHitSharingMap.find(mapEntry.first));
+
+        if (mcParticleToPfoHitSharingMap.end() == iter)
+            continue;
+
+        for (const PfoCaloHitListPair &pfoHitPair : iter->second)
+        {
+            if (pfoToReconstructable2DHitsMap.count(pfoHitPair.first))
+                throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+        }
+    }
+
+    typedef std::unordered_map<const CaloHit *, std::vector<unsigned int>> CaloHitToMCIndicesMap;
+    CaloHitToMCIndicesMap caloHitToMCIndicesMap;
+    unsigned int mcIndex(0);
 
-            for (const MCParticle *const pMCParticle : sortedMCParticles)
+    for (const MCContributionMap &mcParticleToHitsMap : selectedMCParticleToHitsMaps)
+    {
+        for (unsigned int iMC = 0; iMC < mcParticleToHitsMap.size(); ++iMC, ++mcIndex)
+        {
+            const MCParticle *const pMCParticle(sortedMCParticles.at(mcIndex));
+
+            if (mcParticleToPfoHitSharingMap.end() == mcParticleToPfoHitSharingMap.find(pMCParticle))
+                (void)mcParticleToPfoHitSharingMap.insert(MCParticleToPfoHitSharingMap::value_type(pMCParticle, PfoToSharedHitsVector()));
+
+            for (const CaloHit *const pCaloHit : mcParticleToHitsMap.at(pMCParticle))
             {
-                // Add map entries for this Pfo & MCParticle if required
-                if (pfoToMCParticleHitSharingMap.find(pPfo) == pfoToMCParticleHitSharingMap.end())
-                    if (!pfoToMCParticleHitSharingMap.insert(PfoToMCParticleHitSharingMap::value_type(pPfo, MCParticleToSharedHitsVector())).second)
-                        throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT); // ATTN maybe overkill
+                std::vector<unsigned int> &mcIndices(caloHitToMCIndicesMap[pCaloHit]);
+
+                if (mcIndices.empty() || (mcIndices.back() != mcIndex))
+                    mcIndices.push_back(mcIndex);
+            }
+        }
+    }
+
+    // Collect the hits shared by each Pfo and MCParticle in a single pass over the Pfo hits, preserving the Pfo hit order
+    for (const ParticleFlowObject *const pPfo : sortedPfos)
+    {
+        if (pfoToMCParticleHitSharingMap.end() == pfoToMCParticleHitSharingMap.find(pPfo))
+            (void)pfoToMCParticleHitSharingMap.insert(PfoToMCParticleHitSharingMap::value_type(pPfo, MCParticleToSharedHitsVector()));
 
-                if (mcParticleToPfoHitSharingMap.find(pMCParticle) == mcParticleToPfoHitSharingMap.end())
-                    if (!mcParticleToPfoHitSharingMap.insert(MCParticleToPfoHitSharingMap::value_type(pMCParticle, PfoToSharedHitsVector())).second)
-                        throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+        std::map<unsigned int, CaloHitList> mcIndexToSharedHitsMap;
 
-                // Check this Pfo & MCParticle pairing hasn't already been checked
-                MCParticleToSharedHitsVector &mcHitPairs(pfoToMCParticleHitSharingMap.at(pPfo));
-                PfoToSharedHitsVector &pfoHitPairs(mcParticleToPfoHitSharingMap.at(pMCParticle));
+        for (const CaloHit *const pCaloHit : pfoToReconstructable2DHitsMap.at(pPfo))
+        {
+            CaloHitToMCIndicesMap::const_iterator iter(caloHitToMCIndicesMap.find(pCaloHit));
 
-                if (std::any_of(mcHitPairs.begin(), mcHitPairs.end(),
-                        [&](const MCParticleCaloHitListPair &pair) { return (pair.first == pMCParticle); }))
-                    throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+            if (caloHitToMCIndicesMap.end() == iter)
+                continue;
 
-                if (std::any_of(pfoHitPairs.begin(), pfoHitPairs.end(), [&](const PfoCaloHitListPair &pair) { return (pair.first == pPfo); }))
-                    throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+            for (const unsigned int index : iter->second)
+                mcIndexToSharedHitsMap[index].push_back(pCaloHit);
+        }
 
-                // Add records to maps if there are any shared hits
-                const CaloHitList sharedHits(
-                    LArMCParticleHelper::GetSharedHits(pfoToReconstructable2DHitsMap.at(pPfo), mcParticleToHitsMap.at(pMCParticle)));
+        MCParticleToSharedHitsVector &mcHitPairs(pfoToMCParticleHitSharingMap.at(pPfo));
 
-                if (!sharedHits.empty())
-                {
-                    mcHitPairs.push_back(MCParticleCaloHitListPair(pMCParticle, sharedHits));
-                    pfoHitPairs.push_back(PfoCaloHitListPair(pPfo, sharedHits));
+        for (const auto &mapEntry : mcIndexToSharedHitsMap)
+        {
+            const MCParticle *const pMCParticle(sortedMCParticles.at(mapEntry.first));
 
-                    std::sort(mcHitPairs.begin(), mcHitPairs.end(), [](const MCParticleCaloHitListPair &a, const MCParticleCaloHitListPair &b) -> bool {
-                        return ((a.second.size() != b.second.size()) ? a.second.size() > b.second.size()
-                                                                     : LArMCParticleHelper::SortByMomentum(a.first, b.first));
-                    });
+            // ATTN A later appearance of this MCParticle would find the record added here, so the pairing is rejected as before
+            if (mcParticleToLastIndexMap.at(pMCParticle) != mapEntry.first)
+                throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
 
-                    std::sort(pfoHitPairs.begin(), pfoHitPairs.end(), [](const PfoCaloHitListPair &a, const PfoCaloHitListPair &b) -> bool {
-                        return ((a.second.size() != b.second.size()) ? a.second.size() > b.second.size() : LArPfoHelper::SortByNHits(a.first, b.first));
-                    });
-                }
-            }
+            mcHitPairs.push_back(MCParticleCaloHitListPair(pMCParticle, mapEntry.second));
+            mcParticleToPfoHitSharingMap.at(pMCParticle).push_back(PfoCaloHitListPair(pPfo, mapEntry.second));
         }
     }
+
+    // ATTN Records are added in the same order as the exhaustive Pfo x MCParticle comparison, so a stable sort reproduces its ordering
+    auto sortMCHitPairs = [](const MCParticleCaloHitListPair &a, const MCParticleCaloHitListPair &b) -> bool {
+        return ((a.second.size() != b.second.size()) ? a.second.size() > b.second.size()
+                                                     : LArMCParticleHelper::SortByMomentum(a.first, b.first));
+    };
+
+    auto sortPfoHitPairs = [](const PfoCaloHitListPair &a, const PfoCaloHitListPair &b) -> bool {
+        return ((a.second.size() != b.second.size()) ? a.second.size() > b.second.size() : LArPfoHelper::SortByNHits(a.first, b.first));
+    };
+
+    for (auto &mapEntry : pfoToMCParticleHitSharingMap)
+        std::stable_sort(mapEntry.second.begin(), mapEntry.second.end(), sortMCHitPairs);
+
+    for (auto &mapEntry : mcParticleToPfoHitSharingMap)
+        std::stable_sort(mapEntry.second.begin(), mapEntry.second.end(), sortPfoHitPairs);
 }
 
 // private
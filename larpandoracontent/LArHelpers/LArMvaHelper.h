@@ -9,6 +9,7 @@
 #define LAR_MVA_HELPER_H 1
 
 #include "larpandoracontent/LArObjects/LArMvaInterface.h"
+#include "larpandoracontent/LArObjects/LArMvaTrainingWriter.h"
 
 #include "Pandora/AlgorithmTool.h"
 #include "Pandora/StatusCodes.h"
@@ -68,6 +69,21 @@ public:
     template <typename... TLISTS>
     static pandora::StatusCode ProduceTrainingExample(const std::string &trainingOutputFile, const bool result, TLISTS &&... featureLists);
 
+    /**
+     *  @brief  Produce a training example with the given features and result, using a training writer that keeps the output file open
+     *          and buffers the examples written to it
+     *
+     *  @param  trainingWriter the training writer
+     *  @param  trainingOutputFile the file to which to append the example
+     *  @param  result the result
+     *  @param  featureLists the lists of features
+     *
+     *  @return success
+     */
+    template <typename... TLISTS>
+    static pandora::StatusCode ProduceTrainingExample(
+        MvaTrainingWriter &trainingWriter, const std::string &trainingOutputFile, const bool result, TLISTS &&... featureLists);
+
     /**
      *  @brief  Use the trained classifier to predict the boolean class of an example
      *
@@ -123,6 +139,20 @@ public:
     template <typename T, typename... Ts, typename... TARGS>
     static MvaFeatureVector CalculateFeaturesOfType(const MvaFeatureToolVector<Ts...> &featureToolVector, TARGS &&... args);
 
+    /**
+     *  @brief  Calculate the features in a given feature tool vector, together with names formed from the type of the tool providing each
+     *          feature and the index of the feature amongst those the tool provides
+     *
+     *  @param  featureToolVector the feature tool vector
+     *  @param  featureNames to receive the feature names, in the order of the features
+     *  @param  args arguments to pass to the tool
+     *
+     *  @return the vector of features
+     */
+    template <typename... Ts, typename... TARGS>
+    static MvaFeatureVector CalculateFeaturesAndNames(
+        const MvaFeatureToolVector<Ts...> &featureToolVector, pandora::StringVector &featureNames, TARGS &&... args);
+
     /**
      *  @brief  Add a feature tool to a vector of feature tools
      *
@@ -216,6 +246,15 @@ pandora::StatusCode LArMvaHelper::ProduceTrainingExample(const std::string &trai
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename... TLISTS>
+pandora::StatusCode LArMvaHelper::ProduceTrainingExample(
+    MvaTrainingWriter &trainingWriter, const std::string &trainingOutputFile, const bool result, TLISTS &&... featureLists)
+{
+    return trainingWriter.Write(trainingOutputFile, result, ConcatenateFeatureLists(std::forward<TLISTS>(featureLists)...));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename... TLISTS>
 bool LArMvaHelper::Classify(const MvaInterface &classifier, TLISTS &&... featureLists)
 {
@@ -270,6 +309,27 @@ LArMvaHelper::MvaFeatureVector LArMvaHelper::CalculateFeaturesOfType(const MvaFe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename... Ts, typename... TARGS>
+LArMvaHelper::MvaFeatureVector LArMvaHelper::CalculateFeaturesAndNames(
+    const MvaFeatureToolVector<Ts...> &featureToolVector, pandora::StringVector &featureNames, TARGS &&... args)
+{
+    featureNames.clear();
+    LArMvaHelper::MvaFeatureVector featureVector;
+
+    for (MvaFeatureTool<Ts...> *const pFeatureTool : featureToolVector)
+    {
+        const unsigned int nPreviousFeatures(featureVector.size());
+        pFeatureTool->Run(featureVector, std::forward<TARGS>(args)...);
+
+        for (unsigned int iFeature = nPreviousFeatures; iFeature < featureVector.size(); ++iFeature)
+            featureNames.push_back(pFeatureTool->GetType() + "_" + std::to_string(iFeature - nPreviousFeatures));
+    }
+
+    return featureVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename... Ts>
 pandora::StatusCode LArMvaHelper::AddFeatureToolToVector(pandora::AlgorithmTool *const pFeatureTool, MvaFeatureToolVector<Ts...> &featureToolVector)
 {
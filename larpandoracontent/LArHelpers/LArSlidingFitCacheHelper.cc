@@ -0,0 +1,144 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.cc
+ *
+ *  @brief  Implementation of the sliding fit cache helper class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
+
+#include <memory>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+TwoDSlidingFitResultPtr LArSlidingFitCacheHelper::GetSlidingFitResult(
+    const Pandora &pandora, const Cluster *const pCluster, const unsigned int layerFitHalfWindow, const float layerPitch)
+{
+    FitCache &fitCache(LArSlidingFitCacheHelper::GetFitCache());
+
+    {
+        std::lock_guard<std::mutex> lock(fitCache.m_mutex);
+        const CachedFit *const pCachedFit(
+            LArSlidingFitCacheHelper::FindCachedFit(fitCache.m_instanceFitMap[&pandora], pCluster, layerFitHalfWindow, layerPitch));
+
+        if (pCachedFit)
+        {
+            if (STATUS_CODE_SUCCESS != pCachedFit->m_statusCode)
+                throw StatusCodeException(pCachedFit->m_statusCode);
+
+            return pCachedFit->m_pFitResult;
+        }
+    }
+
+    // ATTN The fit is calculated without holding the lock, so that concurrently running pandora instances are not serialised
+    const CachedFit cachedFit(pCluster, layerFitHalfWindow, layerPitch);
+
+    {
+        std::lock_guard<std::mutex> lock(fitCache.m_mutex);
+        ClusterFitMap &clusterFitMap(fitCache.m_instanceFitMap[&pandora]);
+
+        if (!LArSlidingFitCacheHelper::FindCachedFit(clusterFitMap, pCluster, layerFitHalfWindow, layerPitch))
+            clusterFitMap[pCluster].push_back(cachedFit);
+    }
+
+    if (STATUS_CODE_SUCCESS != cachedFit.m_statusCode)
+        throw StatusCodeException(cachedFit.m_statusCode);
+
+    return cachedFit.m_pFitResult;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArSlidingFitCacheHelper::InvalidateCluster(const Pandora &pandora, const Cluster *const pCluster)
+{
+    LArClusterHelper::InvalidateClusterHitIndex(pCluster);
+
+    FitCache &fitCache(LArSlidingFitCacheHelper::GetFitCache());
+    std::lock_guard<std::mutex> lock(fitCache.m_mutex);
+    InstanceFitMap::iterator iter(fitCache.m_instanceFitMap.find(&pandora));
+
+    if (fitCache.m_instanceFitMap.end() != iter)
+        iter->second.erase(pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArSlidingFitCacheHelper::InvalidateClusters(const Pandora &pandora, const ClusterList &clusterList)
+{
+    for (const Cluster *const pCluster : clusterList)
+        LArClusterHelper::InvalidateClusterHitIndex(pCluster);
+
+    FitCache &fitCache(LArSlidingFitCacheHelper::GetFitCache());
+    std::lock_guard<std::mutex> lock(fitCache.m_mutex);
+    InstanceFitMap::iterator iter(fitCache.m_instanceFitMap.find(&pandora));
+
+    if (fitCache.m_instanceFitMap.end() == iter)
+        return;
+
+    for (const Cluster *const pCluster : clusterList)
+        iter->second.erase(pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArSlidingFitCacheHelper::Reset(const Pandora &pandora)
+{
+    LArClusterHelper::ResetClusterHitIndices();
+
+    FitCache &fitCache(LArSlidingFitCacheHelper::GetFitCache());
+    std::lock_guard<std::mutex> lock(fitCache.m_mutex);
+    fitCache.m_instanceFitMap.erase(&pandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArSlidingFitCacheHelper::CachedFit *LArSlidingFitCacheHelper::FindCachedFit(
+    const ClusterFitMap &clusterFitMap, const Cluster *const pCluster, const unsigned int layerFitHalfWindow, const float layerPitch)
+{
+    ClusterFitMap::const_iterator iter(clusterFitMap.find(pCluster));
+
+    if (clusterFitMap.end() == iter)
+        return nullptr;
+
+    for (const CachedFit &cachedFit : iter->second)
+    {
+        if ((layerFitHalfWindow == cachedFit.m_layerFitHalfWindow) && (layerPitch == cachedFit.m_layerPitch))
+            return &cachedFit;
+    }
+
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArSlidingFitCacheHelper::FitCache &LArSlidingFitCacheHelper::GetFitCache()
+{
+    static FitCache fitCache;
+    return fitCache;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArSlidingFitCacheHelper::CachedFit::CachedFit(
+    const Cluster *const pCluster, const unsigned int layerFitHalfWindow, const float layerPitch) :
+    m_layerFitHalfWindow(layerFitHalfWindow),
+    m_layerPitch(layerPitch),
+    m_statusCode(STATUS_CODE_SUCCESS)
+{
+    try
+    {
+        m_pFitResult = std::make_shared<const TwoDSlidingFitResult>(pCluster, layerFitHalfWindow, layerPitch);
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        m_statusCode = statusCodeException.GetStatusCode();
+    }
+}
+
+} // namespace lar_content
@@ -0,0 +1,136 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h
+ *
+ *  @brief  Header file for the sliding fit cache helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_SLIDING_FIT_CACHE_HELPER_H
+#define LAR_SLIDING_FIT_CACHE_HELPER_H 1
+
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace pandora
+{
+class Pandora;
+} // namespace pandora
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArSlidingFitCacheHelper class, sharing two dimensional sliding fit results between the algorithms of a pandora instance for
+ *          the duration of an event. Pandora provides no cluster modification callback, so algorithms that change the hits of a cluster,
+ *          or delete a cluster, must invalidate its fits, and the algorithms and tools using the cache must reset it after each event.
+ */
+class LArSlidingFitCacheHelper
+{
+public:
+    /**
+     *  @brief  Get the two dimensional sliding fit result for a cluster, shared between all algorithms that request a fit with the same
+     *          cluster, layer fit half window and layer pitch. A fit is calculated on first request and reused until the cluster is
+     *          invalidated or the cache is reset. Fit failures are cached and rethrown.
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  pCluster address of the cluster
+     *  @param  layerFitHalfWindow the layer fit half window
+     *  @param  layerPitch the layer pitch, units cm
+     *
+     *  @return the sliding fit result, which remains valid for as long as the pointer is held
+     *
+     *  @throw  StatusCodeException
+     */
+    static TwoDSlidingFitResultPtr GetSlidingFitResult(const pandora::Pandora &pandora, const pandora::Cluster *const pCluster,
+        const unsigned int layerFitHalfWindow, const float layerPitch);
+
+    /**
+     *  @brief  Invalidate the cached fits for a cluster, and this thread's LArClusterHelper hit index for the cluster, to be called whenever
+     *          hits are added to or removed from the cluster, including by merging, and whenever the cluster is deleted
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  pCluster address of the cluster
+     */
+    static void InvalidateCluster(const pandora::Pandora &pandora, const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Invalidate the cached fits, and this thread's LArClusterHelper hit indices, for a list of clusters
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  clusterList the cluster list
+     */
+    static void InvalidateClusters(const pandora::Pandora &pandora, const pandora::ClusterList &clusterList);
+
+    /**
+     *  @brief  Release all cached fits for a pandora instance, and all of this thread's LArClusterHelper hit indices, to be called from
+     *          the Reset function of each algorithm or algorithm tool using the cache, so that no fit or index outlives the event
+     *
+     *  @param  pandora the associated pandora instance
+     */
+    static void Reset(const pandora::Pandora &pandora);
+
+private:
+    /**
+     *  @brief  CachedFit class
+     */
+    class CachedFit
+    {
+    public:
+        /**
+         *  @brief  Constructor, performing the sliding fit
+         *
+         *  @param  pCluster address of the cluster
+         *  @param  layerFitHalfWindow the layer fit half window
+         *  @param  layerPitch the layer pitch, units cm
+         */
+        CachedFit(const pandora::Cluster *const pCluster, const unsigned int layerFitHalfWindow, const float layerPitch);
+
+        unsigned int m_layerFitHalfWindow;    ///< The layer fit half window
+        float m_layerPitch;                   ///< The layer pitch, units cm
+        pandora::StatusCode m_statusCode;     ///< The status code describing the outcome of the fit
+        TwoDSlidingFitResultPtr m_pFitResult; ///< The fit result, if the fit was successful
+    };
+
+    typedef std::vector<CachedFit> CachedFitVector;
+    typedef std::unordered_map<const pandora::Cluster *, CachedFitVector> ClusterFitMap;
+    typedef std::unordered_map<const pandora::Pandora *, ClusterFitMap> InstanceFitMap;
+
+    /**
+     *  @brief  FitCache class, holding the cached fits for the clusters of each pandora instance
+     */
+    class FitCache
+    {
+    public:
+        std::mutex m_mutex;              ///< The mutex guarding the cached fits, as pandora instances may run concurrently
+        InstanceFitMap m_instanceFitMap; ///< The cached fits for the clusters of each pandora instance
+    };
+
+    /**
+     *  @brief  Find a cached fit for a cluster, to be called with the fit cache mutex locked
+     *
+     *  @param  clusterFitMap the cached fits for the clusters of a pandora instance
+     *  @param  pCluster address of the cluster
+     *  @param  layerFitHalfWindow the layer fit half window
+     *  @param  layerPitch the layer pitch, units cm
+     *
+     *  @return the address of the cached fit, or nullptr if there is no cached fit
+     */
+    static const CachedFit *FindCachedFit(const ClusterFitMap &clusterFitMap, const pandora::Cluster *const pCluster,
+        const unsigned int layerFitHalfWindow, const float layerPitch);
+
+    /**
+     *  @brief  Get the process-wide sliding fit cache
+     *
+     *  @return the fit cache
+     */
+    static FitCache &GetFitCache();
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_SLIDING_FIT_CACHE_HELPER_H
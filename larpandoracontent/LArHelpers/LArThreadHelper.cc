@@ -0,0 +1,68 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArThreadHelper.cc
+ *
+ *  @brief  Implementation of the thread helper class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArHelpers/LArThreadHelper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace lar_content
+{
+
+void LArThreadHelper::ParallelFor(const unsigned int nTasks, const unsigned int nThreads, const IndexedTask &task)
+{
+    const unsigned int nUsedThreads(std::min(nThreads, nTasks));
+
+    if (nUsedThreads < 2)
+    {
+        for (unsigned int index = 0; index < nTasks; ++index)
+            task(index);
+
+        return;
+    }
+
+    std::atomic<unsigned int> nextIndex(0);
+    std::vector<std::exception_ptr> exceptions(nTasks);
+
+    auto worker = [&]() {
+        for (unsigned int index = nextIndex++; index < nTasks; index = nextIndex++)
+        {
+            try
+            {
+                task(index);
+            }
+            catch (...)
+            {
+                exceptions[index] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nUsedThreads - 1);
+
+    for (unsigned int iThread = 1; iThread < nUsedThreads; ++iThread)
+        threads.emplace_back(worker);
+
+    // ATTN The calling thread also takes part in processing the tasks
+    worker();
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    for (const std::exception_ptr &pException : exceptions)
+    {
+        if (pException)
+            std::rethrow_exception(pException);
+    }
+}
+
+} // namespace lar_content
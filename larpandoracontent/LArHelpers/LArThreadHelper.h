@@ -0,0 +1,38 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArThreadHelper.h
+ *
+ *  @brief  Header file for the thread helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_THREAD_HELPER_H
+#define LAR_THREAD_HELPER_H 1
+
+#include <functional>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArThreadHelper class
+ */
+class LArThreadHelper
+{
+public:
+    typedef std::function<void(const unsigned int)> IndexedTask;
+
+    /**
+     *  @brief  Execute a number of independent, indexed tasks using a pool of threads. Each task index is processed exactly once, but
+     *          the order of execution is not defined. If any task throws, the exception raised by the lowest task index is rethrown in
+     *          the calling thread once all threads have been joined.
+     *
+     *  @param  nTasks the number of tasks, indexed from zero
+     *  @param  nThreads the maximum number of threads to use (values of zero or one result in serial execution in the calling thread)
+     *  @param  task the task to execute for each index
+     */
+    static void ParallelFor(const unsigned int nTasks, const unsigned int nThreads, const IndexedTask &task);
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_THREAD_HELPER_H
@@ -372,6 +372,8 @@ AdaBoostDecisionTree::StrongClassifier::StrongClassifier(const TiXmlHandle *cons
 
         pCurrentXmlElement = pCurrentXmlElement->NextSiblingElement();
     }
+
+    m_compiledForest.Compile(m_weakClassifiers);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -380,6 +382,8 @@ AdaBoostDecisionTree::StrongClassifier::StrongClassifier(const StrongClassifier
 {
     for (const WeakClassifier *const pWeakClassifier : rhs.m_weakClassifiers)
         m_weakClassifiers.emplace_back(new WeakClassifier(*pWeakClassifier));
+
+    m_compiledForest.Compile(m_weakClassifiers);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -390,6 +394,8 @@ AdaBoostDecisionTree::StrongClassifier &AdaBoostDecisionTree::StrongClassifier::
     {
         for (const WeakClassifier *const pWeakClassifier : rhs.m_weakClassifiers)
             m_weakClassifiers.emplace_back(new WeakClassifier(*pWeakClassifier));
+
+        m_compiledForest.Compile(m_weakClassifiers);
     }
 
     return *this;
@@ -406,6 +412,16 @@ AdaBoostDecisionTree::StrongClassifier::~StrongClassifier()
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 double AdaBoostDecisionTree::StrongClassifier::Predict(const LArMvaHelper::MvaFeatureVector &features) const
+{
+    if (m_compiledForest.CanEvaluate(features))
+        return m_compiledForest.Evaluate(features);
+
+    return this->PredictUsingNodeMaps(features);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double AdaBoostDecisionTree::StrongClassifier::PredictUsingNodeMaps(const LArMvaHelper::MvaFeatureVector &features) const
 {
     double score(0.), weights(0.);
 
@@ -454,4 +470,129 @@ StatusCode AdaBoostDecisionTree::StrongClassifier::ReadComponent(TiXmlElement *p
     return STATUS_CODE_INVALID_PARAMETER;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+AdaBoostDecisionTree::CompiledForest::CompiledForest() : m_totalWeight(0.), m_isValid(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void AdaBoostDecisionTree::CompiledForest::Compile(const WeakClassifiers &weakClassifiers)
+{
+    *this = CompiledForest();
+
+    std::set<unsigned int> usedVariableIds;
+
+    for (const WeakClassifier *const pWeakClassifier : weakClassifiers)
+    {
+        std::set<int> nodeIds;
+        m_rootIndices.push_back(m_variableIds.size());
+
+        // ATTN Evaluation of an incomplete tree throws for any input, so such forests are always evaluated using the node maps
+        if (!this->AddNode(pWeakClassifier->GetIdToNodeMap(), 0, nodeIds))
+        {
+            *this = CompiledForest();
+            return;
+        }
+
+        m_weights.push_back(pWeakClassifier->GetWeight());
+        m_totalWeight += pWeakClassifier->GetWeight();
+    }
+
+    if (m_totalWeight <= std::numeric_limits<double>::epsilon())
+    {
+        *this = CompiledForest();
+        return;
+    }
+
+    for (const int variableId : m_variableIds)
+    {
+        if (variableId >= 0)
+            usedVariableIds.insert(static_cast<unsigned int>(variableId));
+    }
+
+    m_usedVariableIds.assign(usedVariableIds.begin(), usedVariableIds.end());
+    m_isValid = true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool AdaBoostDecisionTree::CompiledForest::CanEvaluate(const LArMvaHelper::MvaFeatureVector &features) const
+{
+    if (!m_isValid)
+        return false;
+
+    if (!m_usedVariableIds.empty() && (features.size() <= m_usedVariableIds.back()))
+        return false;
+
+    for (const unsigned int variableId : m_usedVariableIds)
+    {
+        if (!features[variableId].IsInitialized())
+            return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double AdaBoostDecisionTree::CompiledForest::Evaluate(const LArMvaHelper::MvaFeatureVector &features) const
+{
+    double score(0.);
+
+    for (unsigned int iTree = 0; iTree < m_rootIndices.size(); ++iTree)
+        score += m_outcomes[this->FindLeafIndex(m_rootIndices[iTree], features)] ? m_weights[iTree] : -m_weights[iTree];
+
+    return score / m_totalWeight;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool AdaBoostDecisionTree::CompiledForest::AddNode(const IdToNodeMap &idToNodeMap, const int nodeId, std::set<int> &nodeIds)
+{
+    IdToNodeMap::const_iterator iter(idToNodeMap.find(nodeId));
+
+    if ((idToNodeMap.end() == iter) || !nodeIds.insert(nodeId).second)
+        return false;
+
+    const Node *const pNode(iter->second);
+    const unsigned int nodeIndex(m_variableIds.size());
+
+    m_variableIds.push_back(pNode->IsLeaf() ? -1 : pNode->GetVariableId());
+    m_thresholds.push_back(pNode->IsLeaf() ? 0. : pNode->GetThreshold());
+    m_childIndices.insert(m_childIndices.end(), 2, nodeIndex);
+    m_outcomes.push_back(pNode->IsLeaf() && pNode->GetOutcome() ? 1 : 0);
+
+    if (pNode->IsLeaf())
+        return true;
+
+    if (pNode->GetVariableId() < 0)
+        return false;
+
+    m_childIndices[2 * nodeIndex] = m_variableIds.size();
+
+    if (!this->AddNode(idToNodeMap, pNode->GetLeftChildNodeId(), nodeIds))
+        return false;
+
+    m_childIndices[2 * nodeIndex + 1] = m_variableIds.size();
+
+    return this->AddNode(idToNodeMap, pNode->GetRightChildNodeId(), nodeIds);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int AdaBoostDecisionTree::CompiledForest::FindLeafIndex(
+    const unsigned int rootIndex, const LArMvaHelper::MvaFeatureVector &features) const
+{
+    unsigned int nodeIndex(rootIndex);
+
+    // ATTN Matches the node map evaluation, including for not-a-number features, which follow the right child
+    while (m_variableIds[nodeIndex] >= 0)
+        nodeIndex = m_childIndices[2 * nodeIndex + ((features[m_variableIds[nodeIndex]].Get() <= m_thresholds[nodeIndex]) ? 0 : 1)];
+
+    return nodeIndex;
+}
+
 } // namespace lar_content
@@ -16,6 +16,7 @@
 
 #include <functional>
 #include <map>
+#include <set>
 #include <vector>
 
 namespace lar_content
@@ -255,6 +256,13 @@ private:
          */
         int GetTreeId() const;
 
+        /**
+         *  @brief  Get the decision tree nodes, indexed by node id
+         *
+         *  @return the id to node map
+         */
+        const IdToNodeMap &GetIdToNodeMap() const;
+
     private:
         IdToNodeMap m_idToNodeMap; ///< Decision tree nodes
         double m_weight;           ///< Boost weight
@@ -263,6 +271,77 @@ private:
 
     typedef std::vector<const WeakClassifier *> WeakClassifiers;
 
+    /**
+     *  @brief  CompiledForest class, holding the decision trees of a strong classifier in contiguous arrays for fast evaluation
+     */
+    class CompiledForest
+    {
+    public:
+        /**
+         *  @brief  Default constructor, creating an invalid (empty) forest
+         */
+        CompiledForest();
+
+        /**
+         *  @brief  Compile the decision trees of a list of weak classifiers. Forests whose evaluation could throw for all inputs, i.e.
+         *          those with incomplete tree hierarchies or with weights summing to zero, are left invalid.
+         *
+         *  @param  weakClassifiers the weak classifiers
+         */
+        void Compile(const WeakClassifiers &weakClassifiers);
+
+        /**
+         *  @brief  Whether a set of input features can be scored by the compiled forest, i.e. whether the forest is valid and all features
+         *          used in its decisions are present and initialized
+         *
+         *  @param  features the input features
+         *
+         *  @return boolean
+         */
+        bool CanEvaluate(const LArMvaHelper::MvaFeatureVector &features) const;
+
+        /**
+         *  @brief  Calculate the score for a set of input features, which must satisfy CanEvaluate
+         *
+         *  @param  features the input features
+         *
+         *  @return the score
+         */
+        double Evaluate(const LArMvaHelper::MvaFeatureVector &features) const;
+
+    private:
+        /**
+         *  @brief  Add a node and, recursively, its children to the compiled forest, in depth first order
+         *
+         *  @param  idToNodeMap the decision tree nodes, indexed by node id
+         *  @param  nodeId the id of the node to add
+         *  @param  nodeIds to receive the ids of the nodes added for this decision tree
+         *
+         *  @return whether the node and all of its descendants could be added
+         */
+        bool AddNode(const IdToNodeMap &idToNodeMap, const int nodeId, std::set<int> &nodeIds);
+
+        /**
+         *  @brief  Find the leaf node reached by a set of input features in a given decision tree
+         *
+         *  @param  rootIndex the index of the root node of the decision tree
+         *  @param  features the input features
+         *
+         *  @return the index of the leaf node
+         */
+        unsigned int FindLeafIndex(const unsigned int rootIndex, const LArMvaHelper::MvaFeatureVector &features) const;
+
+        std::vector<int> m_variableIds;              ///< The variable cut on at each node, or -1 for leaf nodes
+        std::vector<double> m_thresholds;            ///< The threshold used for the decision at each node
+        std::vector<unsigned int> m_childIndices;    ///< The indices of the left and right children of each node, stored in pairs
+        std::vector<unsigned char> m_outcomes;       ///< The outcome at each node, if a leaf node
+        std::vector<unsigned int> m_rootIndices;     ///< The index of the root node of each decision tree
+        std::vector<double> m_weights;               ///< The boost weight of each decision tree
+        std::vector<unsigned int> m_usedVariableIds; ///< The variables cut on anywhere in the forest
+        double m_totalWeight;                        ///< The sum of the boost weights, accumulated in decision tree order
+        bool m_isValid;                              ///< Whether the forest was compiled successfully
+    };
+
     /**
      *  @brief  StrongClassifier class used in application of adaptive boost decision tree
      */
@@ -310,7 +389,17 @@ private:
          */
         pandora::StatusCode ReadComponent(pandora::TiXmlElement *pCurrentXmlElement);
 
+        /**
+         *  @brief  Predict signal or background by walking the node maps of the weak classifiers
+         *
+         *  @param  features the input features
+         *
+         *  @return return score produced from trained model
+         */
+        double PredictUsingNodeMaps(const LArMvaHelper::MvaFeatureVector &features) const;
+
         WeakClassifiers m_weakClassifiers; ///< Vector of weak classifers
+        CompiledForest m_compiledForest;   ///< The weak classifier decision trees, compiled for fast evaluation
     };
 
     /**
@@ -395,6 +484,13 @@ inline int AdaBoostDecisionTree::WeakClassifier::GetTreeId() const
     return m_treeId;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const AdaBoostDecisionTree::IdToNodeMap &AdaBoostDecisionTree::WeakClassifier::GetIdToNodeMap() const
+{
+    return m_idToNodeMap;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_ADABOOST_DECISION_TREE_H
@@ -0,0 +1,342 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArMvaTrainingWriter.cc
+ *
+ *  @brief  Implementation of the lar mva training writer class.
+ *
+ *  $Log: $
+ */
+
+#include "Helpers/XmlHelper.h"
+
+#include "larpandoracontent/LArObjects/LArMvaTrainingWriter.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+MvaTrainingWriter::MvaTrainingWriter(const Format format, const unsigned int maxBufferedExamples) :
+    m_format(format),
+    m_maxBufferedExamples(maxBufferedExamples),
+    m_lastTimestamp(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+MvaTrainingWriter::~MvaTrainingWriter()
+{
+    this->Flush();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MvaTrainingWriter::Create(const TiXmlHandle xmlHandle, std::unique_ptr<MvaTrainingWriter> &pTrainingWriter)
+{
+    std::string formatName("CSV");
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFormat", formatName));
+
+    unsigned int maxBufferedExamples(1000);
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TrainingBufferSize", maxBufferedExamples));
+
+    if (0 == maxBufferedExamples)
+    {
+        std::cout << "MvaTrainingWriter: TrainingBufferSize must be greater than zero" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    Format format(CSV);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, MvaTrainingWriter::GetFormat(formatName, format));
+
+    pTrainingWriter.reset(new MvaTrainingWriter(format, maxBufferedExamples));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool MvaTrainingWriter::NeedsFeatureNames(const std::string &fileName)
+{
+    if (BINARY != m_format)
+        return false;
+
+    OutputFile *pOutputFile(nullptr);
+
+    // ATTN A file that cannot be opened is reported when examples are written
+    if (STATUS_CODE_SUCCESS != this->GetOutputFile(fileName, pOutputFile))
+        return false;
+
+    return (!pOutputFile->m_isSchemaWritten && pOutputFile->m_featureNames.empty());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MvaTrainingWriter::SetFeatureNames(const std::string &fileName, const StringVector &featureNames)
+{
+    OutputFile *pOutputFile(nullptr);
+
+    // ATTN A file that cannot be opened is reported when examples are written
+    if ((STATUS_CODE_SUCCESS == this->GetOutputFile(fileName, pOutputFile)) && !pOutputFile->m_isSchemaWritten)
+        pOutputFile->m_featureNames = featureNames;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MvaTrainingWriter::Write(const std::string &fileName, const bool result, const MvaTypes::MvaFeatureVector &featureVector)
+{
+    OutputFile *pOutputFile(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetOutputFile(fileName, pOutputFile));
+
+    // ATTN Check the features before buffering anything, so an uninitialized feature cannot leave a partial example
+    for (const MvaTypes::MvaFeature &feature : featureVector)
+    {
+        if (!feature.IsInitialized())
+            throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+    }
+
+    const std::time_t timestamp(std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()));
+
+    if (CSV == m_format)
+    {
+        const std::string delimiter(",");
+        pOutputFile->m_csvBuffer << this->GetTimestampString(timestamp) << delimiter;
+
+        for (const MvaTypes::MvaFeature &feature : featureVector)
+            pOutputFile->m_csvBuffer << feature.Get() << delimiter;
+
+        pOutputFile->m_csvBuffer << static_cast<int>(result) << '\n';
+    }
+    else
+    {
+        if (!pOutputFile->m_isSchemaWritten)
+        {
+            pOutputFile->m_nFeatures = featureVector.size();
+
+            if (pOutputFile->m_featureNames.empty())
+            {
+                for (unsigned int iFeature = 0; iFeature < pOutputFile->m_nFeatures; ++iFeature)
+                    pOutputFile->m_featureNames.push_back("feature_" + std::to_string(iFeature));
+            }
+
+            if (pOutputFile->m_featureNames.size() != pOutputFile->m_nFeatures)
+            {
+                std::cout << "MvaTrainingWriter: " << pOutputFile->m_featureNames.size() << " feature names provided for "
+                          << pOutputFile->m_nFeatures << " features in " << fileName << std::endl;
+                return STATUS_CODE_INVALID_PARAMETER;
+            }
+
+            this->WriteSchema(*pOutputFile);
+            pOutputFile->m_isSchemaWritten = true;
+        }
+
+        if (featureVector.size() != pOutputFile->m_nFeatures)
+        {
+            std::cout << "MvaTrainingWriter: example with " << featureVector.size() << " features does not match schema with "
+                      << pOutputFile->m_nFeatures << " features in " << fileName << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+
+        pOutputFile->m_timestamps.push_back(static_cast<int64_t>(timestamp));
+
+        for (const MvaTypes::MvaFeature &feature : featureVector)
+            pOutputFile->m_features.push_back(feature.Get());
+
+        pOutputFile->m_results.push_back(static_cast<unsigned char>(result));
+    }
+
+    if (++pOutputFile->m_nBufferedExamples >= m_maxBufferedExamples)
+        return this->Flush(*pOutputFile);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MvaTrainingWriter::Flush()
+{
+    StatusCode statusCode(STATUS_CODE_SUCCESS);
+
+    for (OutputFileMap::value_type &mapEntry : m_outputFileMap)
+    {
+        const StatusCode fileStatusCode(this->Flush(*mapEntry.second));
+
+        if (STATUS_CODE_SUCCESS != fileStatusCode)
+            statusCode = fileStatusCode;
+    }
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MvaTrainingWriter::GetFormat(const std::string &formatName, Format &format)
+{
+    if ("CSV" == formatName)
+    {
+        format = CSV;
+    }
+    else if ("Binary" == formatName)
+    {
+        format = BINARY;
+    }
+    else
+    {
+        std::cout << "MvaTrainingWriter: unknown training output format " << formatName << ", expected CSV or Binary" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MvaTrainingWriter::GetOutputFile(const std::string &fileName, OutputFile *&pOutputFile)
+{
+    OutputFileMap::const_iterator iter(m_outputFileMap.find(fileName));
+
+    if (m_outputFileMap.end() != iter)
+    {
+        pOutputFile = iter->second.get();
+        return STATUS_CODE_SUCCESS;
+    }
+
+    std::unique_ptr<OutputFile> pNewOutputFile(new OutputFile(fileName));
+    pNewOutputFile->m_outfile.open(fileName, (CSV == m_format) ? std::ios_base::app : (std::ios_base::app | std::ios_base::binary));
+
+    if (!pNewOutputFile->m_outfile.is_open())
+    {
+        std::cout << "MvaTrainingWriter: could not open file for training examples at " << fileName << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    // ATTN Examples appended to an existing binary file must follow the schema already written there
+    if (BINARY == m_format)
+    {
+        pNewOutputFile->m_outfile.seekp(0, std::ios_base::end);
+
+        if (pNewOutputFile->m_outfile.tellp() > 0)
+        {
+            std::ifstream infile(fileName, std::ios_base::binary);
+            std::string magic(8, ' ');
+            uint32_t nFeatures(0);
+
+            infile.read(&magic[0], magic.size());
+            infile.read(reinterpret_cast<char *>(&nFeatures), sizeof(nFeatures));
+
+            if (!infile.good() || ("LARMVA01" != magic))
+            {
+                std::cout << "MvaTrainingWriter: existing file at " << fileName << " is not a binary training example file" << std::endl;
+                return STATUS_CODE_FAILURE;
+            }
+
+            pNewOutputFile->m_nFeatures = nFeatures;
+            pNewOutputFile->m_isSchemaWritten = true;
+        }
+    }
+
+    pOutputFile = pNewOutputFile.get();
+    m_outputFileMap.emplace(fileName, std::move(pNewOutputFile));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MvaTrainingWriter::WriteSchema(OutputFile &outputFile) const
+{
+    const std::string magic("LARMVA01");
+    const uint32_t nFeatures(outputFile.m_nFeatures);
+
+    outputFile.m_outfile.write(magic.data(), magic.size());
+    outputFile.m_outfile.write(reinterpret_cast<const char *>(&nFeatures), sizeof(nFeatures));
+
+    for (const std::string &featureName : outputFile.m_featureNames)
+    {
+        const uint32_t nameLength(featureName.size());
+        outputFile.m_outfile.write(reinterpret_cast<const char *>(&nameLength), sizeof(nameLength));
+        outputFile.m_outfile.write(featureName.data(), featureName.size());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MvaTrainingWriter::Flush(OutputFile &outputFile) const
+{
+    if (0 == outputFile.m_nBufferedExamples)
+        return STATUS_CODE_SUCCESS;
+
+    if (CSV == m_format)
+    {
+        outputFile.m_outfile << outputFile.m_csvBuffer.str();
+        outputFile.m_csvBuffer.str(std::string());
+    }
+    else
+    {
+        const uint32_t nExamples(outputFile.m_nBufferedExamples);
+        outputFile.m_outfile.write(reinterpret_cast<const char *>(&nExamples), sizeof(nExamples));
+        outputFile.m_outfile.write(reinterpret_cast<const char *>(outputFile.m_timestamps.data()), nExamples * sizeof(int64_t));
+
+        std::vector<double> featureColumn(nExamples);
+
+        for (unsigned int iFeature = 0; iFeature < outputFile.m_nFeatures; ++iFeature)
+        {
+            for (unsigned int iExample = 0; iExample < nExamples; ++iExample)
+                featureColumn[iExample] = outputFile.m_features[iExample * outputFile.m_nFeatures + iFeature];
+
+            outputFile.m_outfile.write(reinterpret_cast<const char *>(featureColumn.data()), nExamples * sizeof(double));
+        }
+
+        outputFile.m_outfile.write(reinterpret_cast<const char *>(outputFile.m_results.data()), nExamples * sizeof(unsigned char));
+        outputFile.m_timestamps.clear();
+        outputFile.m_features.clear();
+        outputFile.m_results.clear();
+    }
+
+    outputFile.m_nBufferedExamples = 0;
+    outputFile.m_outfile.flush();
+
+    if (!outputFile.m_outfile.good())
+    {
+        std::cout << "MvaTrainingWriter: could not write training examples to " << outputFile.m_fileName << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const std::string &MvaTrainingWriter::GetTimestampString(const std::time_t timestamp)
+{
+    if (!m_lastTimestampString.empty() && (timestamp == m_lastTimestamp))
+        return m_lastTimestampString;
+
+    char buffer[80];
+    const struct tm *const pTimeInfo(localtime(&timestamp));
+    strftime(buffer, 80, "%x_%X", pTimeInfo);
+
+    m_lastTimestamp = timestamp;
+    m_lastTimestampString = buffer;
+
+    if (!m_lastTimestampString.empty() && m_lastTimestampString.back() == '\n')
+        m_lastTimestampString.pop_back();
+
+    return m_lastTimestampString;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+MvaTrainingWriter::OutputFile::OutputFile(const std::string &fileName) :
+    m_fileName(fileName),
+    m_isSchemaWritten(false),
+    m_nFeatures(0),
+    m_nBufferedExamples(0)
+{
+}
+
+} // namespace lar_content
@@ -0,0 +1,194 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArMvaTrainingWriter.h
+ *
+ *  @brief  Header file for the lar mva training writer class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_MVA_TRAINING_WRITER_H
+#define LAR_MVA_TRAINING_WRITER_H 1
+
+#include "larpandoracontent/LArObjects/LArMvaInterface.h"
+
+#include "Helpers/XmlHelper.h"
+#include "Pandora/PandoraInternal.h"
+#include "Pandora/StatusCodes.h"
+
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  MvaTrainingWriter class, keeping training example files open for the lifetime of the owning algorithm and buffering the
+ *          examples written to them.
+ *
+ *          The CSV format is identical to that of LArMvaHelper::ProduceTrainingExample: one line per example holding a timestamp, the
+ *          features and the boolean result. The binary format is columnar, in host byte order. The file begins with a schema header
+ *          (the eight characters "LARMVA01", a uint32 number of features, then for each feature a uint32 name length and the name
+ *          characters) and is followed by blocks, each holding a uint32 number of examples n, then n int64 timestamps (seconds since
+ *          the epoch), n doubles for each feature in turn and n uint8 results. Examples appended to an existing binary file are assumed
+ *          to follow the schema already written.
+ */
+class MvaTrainingWriter
+{
+public:
+    /**
+     *  @brief  Format enum
+     */
+    enum Format
+    {
+        CSV,
+        BINARY
+    };
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  format the output format
+     *  @param  maxBufferedExamples the number of examples to buffer for each file before writing them out
+     */
+    MvaTrainingWriter(const Format format, const unsigned int maxBufferedExamples);
+
+    /**
+     *  @brief  Destructor, writing out any buffered examples
+     */
+    ~MvaTrainingWriter();
+
+    /**
+     *  @brief  Create a training writer, configured by the optional TrainingOutputFormat ("CSV" or "Binary") and TrainingBufferSize
+     *          settings of an algorithm
+     *
+     *  @param  xmlHandle the xml handle of the algorithm
+     *  @param  pTrainingWriter to receive the training writer
+     *
+     *  @return success
+     */
+    static pandora::StatusCode Create(const pandora::TiXmlHandle xmlHandle, std::unique_ptr<MvaTrainingWriter> &pTrainingWriter);
+
+    /**
+     *  @brief  Whether the schema for a file still requires the feature names, which is only the case for binary files that did not
+     *          exist, or were empty, when opened and to which no examples have yet been written
+     *
+     *  @param  fileName the file name
+     *
+     *  @return boolean
+     */
+    bool NeedsFeatureNames(const std::string &fileName);
+
+    /**
+     *  @brief  Set the feature names for a file, to be recorded in the schema. Features are otherwise named by their index.
+     *
+     *  @param  fileName the file name
+     *  @param  featureNames the feature names
+     */
+    void SetFeatureNames(const std::string &fileName, const pandora::StringVector &featureNames);
+
+    /**
+     *  @brief  Write a training example, opening the file in append mode on the first request
+     *
+     *  @param  fileName the file name
+     *  @param  result the boolean result
+     *  @param  featureVector the features
+     *
+     *  @return success
+     */
+    pandora::StatusCode Write(const std::string &fileName, const bool result, const MvaTypes::MvaFeatureVector &featureVector);
+
+    /**
+     *  @brief  Write out the buffered examples for all files
+     *
+     *  @return success
+     */
+    pandora::StatusCode Flush();
+
+private:
+    /**
+     *  @brief  OutputFile class
+     */
+    class OutputFile
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  fileName the file name
+         */
+        OutputFile(const std::string &fileName);
+
+        std::string m_fileName;               ///< The file name
+        std::ofstream m_outfile;              ///< The output stream, open for as long as the writer exists
+        pandora::StringVector m_featureNames; ///< The feature names for the schema
+        bool m_isSchemaWritten;               ///< Whether the binary schema has been written
+        unsigned int m_nFeatures;             ///< The number of features per example, fixed for binary files by the schema
+        unsigned int m_nBufferedExamples;     ///< The number of buffered examples
+        std::ostringstream m_csvBuffer;       ///< The buffered csv lines
+        std::vector<int64_t> m_timestamps;    ///< The buffered binary timestamps
+        std::vector<double> m_features;       ///< The buffered binary features, example by example
+        std::vector<unsigned char> m_results; ///< The buffered binary results
+    };
+
+    typedef std::map<std::string, std::unique_ptr<OutputFile>> OutputFileMap;
+
+    /**
+     *  @brief  Get the output format corresponding to a format name
+     *
+     *  @param  formatName the format name
+     *  @param  format to receive the output format
+     *
+     *  @return success
+     */
+    static pandora::StatusCode GetFormat(const std::string &formatName, Format &format);
+
+    /**
+     *  @brief  Get the output file for a file name, opening it on the first request
+     *
+     *  @param  fileName the file name
+     *  @param  pOutputFile to receive the address of the output file
+     *
+     *  @return success
+     */
+    pandora::StatusCode GetOutputFile(const std::string &fileName, OutputFile *&pOutputFile);
+
+    /**
+     *  @brief  Write the binary schema header for a file
+     *
+     *  @param  outputFile the output file
+     */
+    void WriteSchema(OutputFile &outputFile) const;
+
+    /**
+     *  @brief  Write out the buffered examples for a file
+     *
+     *  @param  outputFile the output file
+     *
+     *  @return success
+     */
+    pandora::StatusCode Flush(OutputFile &outputFile) const;
+
+    /**
+     *  @brief  Get the csv timestamp string for a time, reusing the previous string for repeated requests within the same second
+     *
+     *  @param  timestamp the time
+     *
+     *  @return the timestamp string
+     */
+    const std::string &GetTimestampString(const std::time_t timestamp);
+
+    Format m_format;                    ///< The output format
+    unsigned int m_maxBufferedExamples; ///< The number of examples to buffer for each file before writing them out
+    OutputFileMap m_outputFileMap;      ///< The output files, keyed by file name
+    std::time_t m_lastTimestamp;        ///< The time for which the timestamp string was last formatted
+    std::string m_lastTimestampString;  ///< The timestamp string last formatted
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_MVA_TRAINING_WRITER_H
@@ -26,6 +26,7 @@ SupportVectorMachine::SupportVectorMachine() :
     m_scaleFactor(1.),
     m_kernelType(QUADRATIC),
     m_kernelFunction(QuadraticKernel),
+    m_kernelFunctionType(QUADRATIC),
     m_kernelMap{{LINEAR, LinearKernel}, {QUADRATIC, QuadraticKernel}, {CUBIC, CubicKernel}, {GAUSSIAN_RBF, GaussianRbfKernel}}
 {
 }
@@ -74,6 +75,20 @@ StatusCode SupportVectorMachine::Initialize(const std::string &parameterLocation
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
     }
 
+    // Store the support vectors feature by feature, so that each feature value is compared against all support vectors in turn
+    const unsigned int nSupportVectors(m_svInfoList.size());
+    m_supportVectorMatrix.resize(m_nFeatures * nSupportVectors);
+    m_yAlphaVector.resize(nSupportVectors);
+
+    for (unsigned int iSupportVector = 0; iSupportVector < nSupportVectors; ++iSupportVector)
+    {
+        const SupportVectorInfo &svInfo(m_svInfoList.at(iSupportVector));
+        m_yAlphaVector.at(iSupportVector) = svInfo.m_yAlpha;
+
+        for (unsigned int iFeature = 0; iFeature < m_nFeatures; ++iFeature)
+            m_supportVectorMatrix.at(iFeature * nSupportVectors + iSupportVector) = svInfo.m_supportVector.at(iFeature).Get();
+    }
+
     m_isInitialized = true;
     return STATUS_CODE_SUCCESS;
 }
@@ -194,7 +209,10 @@ StatusCode SupportVectorMachine::ReadMachine(const TiXmlHandle &currentHandle)
     m_probBParameter = probBParameter;
 
     if (kernelType != USER_DEFINED) // if user-defined, leave it so it alone can be set before/after initialization
+    {
         m_kernelFunction = m_kernelMap.at(m_kernelType);
+        m_kernelFunctionType = m_kernelType;
+    }
 
     return STATUS_CODE_SUCCESS;
 }
@@ -262,6 +280,12 @@ double SupportVectorMachine::CalculateClassificationScoreImpl(const LArMvaHelper
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
     }
 
+    std::vector<double> featureValues, kernelValues;
+
+    if (this->GetFeatureValues(features, featureValues))
+        return this->CalculateMatrixClassificationScore(featureValues, kernelValues);
+
+    // ATTN User-defined kernels, and feature vectors that are incomplete or uninitialized, are evaluated feature vector by feature vector
     LArMvaHelper::MvaFeatureVector standardizedFeatures;
     standardizedFeatures.reserve(m_nFeatures);
 
@@ -281,4 +305,89 @@ double SupportVectorMachine::CalculateClassificationScoreImpl(const LArMvaHelper
     return classScore + m_bias;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool SupportVectorMachine::GetFeatureValues(const LArMvaHelper::MvaFeatureVector &features, std::vector<double> &featureValues) const
+{
+    if ((USER_DEFINED == m_kernelFunctionType) || (features.size() != m_nFeatures))
+        return false;
+
+    featureValues.resize(m_nFeatures);
+
+    for (unsigned int iFeature = 0; iFeature < m_nFeatures; ++iFeature)
+    {
+        const LArMvaHelper::MvaFeature &feature(features[iFeature]);
+
+        if (!feature.IsInitialized())
+            return false;
+
+        featureValues[iFeature] = m_standardizeFeatures ? m_featureInfoList[iFeature].StandardizeParameter(feature.Get()) : feature.Get();
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double SupportVectorMachine::CalculateMatrixClassificationScore(
+    const std::vector<double> &featureValues, std::vector<double> &kernelValues) const
+{
+    // ATTN Each kernel value accumulates its terms in feature order, matching the kernel functions, so the score is unchanged
+    const unsigned int nSupportVectors(m_yAlphaVector.size());
+    kernelValues.assign(nSupportVectors, 0.);
+
+    if (GAUSSIAN_RBF == m_kernelFunctionType)
+    {
+        for (unsigned int iFeature = 0; iFeature < m_nFeatures; ++iFeature)
+        {
+            const double featureValue(featureValues[iFeature]);
+            const double *const pSupportVectorValues(&m_supportVectorMatrix[iFeature * nSupportVectors]);
+
+            for (unsigned int iSupportVector = 0; iSupportVector < nSupportVectors; ++iSupportVector)
+            {
+                const double difference(pSupportVectorValues[iSupportVector] - featureValue);
+                kernelValues[iSupportVector] += difference * difference;
+            }
+        }
+
+        for (double &kernelValue : kernelValues)
+            kernelValue = std::exp(-m_scaleFactor * kernelValue);
+    }
+    else
+    {
+        const double denominator(m_scaleFactor * m_scaleFactor);
+        if (denominator < std::numeric_limits<double>::epsilon())
+            throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+        for (unsigned int iFeature = 0; iFeature < m_nFeatures; ++iFeature)
+        {
+            const double featureValue(featureValues[iFeature]);
+            const double *const pSupportVectorValues(&m_supportVectorMatrix[iFeature * nSupportVectors]);
+
+            for (unsigned int iSupportVector = 0; iSupportVector < nSupportVectors; ++iSupportVector)
+                kernelValues[iSupportVector] += pSupportVectorValues[iSupportVector] * featureValue;
+        }
+
+        for (double &kernelValue : kernelValues)
+        {
+            const double total(kernelValue / denominator);
+
+            if (LINEAR == m_kernelFunctionType)
+            {
+                kernelValue = total;
+                continue;
+            }
+
+            const double shiftedTotal(total + 1.);
+            kernelValue = (QUADRATIC == m_kernelFunctionType) ? shiftedTotal * shiftedTotal : shiftedTotal * shiftedTotal * shiftedTotal;
+        }
+    }
+
+    double classScore(0.);
+    for (unsigned int iSupportVector = 0; iSupportVector < nSupportVectors; ++iSupportVector)
+        classScore += m_yAlphaVector[iSupportVector] * kernelValues[iSupportVector];
+
+    return classScore + m_bias;
+}
+
 } // namespace lar_content
@@ -179,8 +179,12 @@ private:
 
     KernelType m_kernelType;         ///< The kernel type
     KernelFunction m_kernelFunction; ///< The kernel function
+    KernelType m_kernelFunctionType; ///< The type of the kernel function in use, user-defined if set via SetKernelFunction
     KernelMap m_kernelMap;           ///< Map from the kernel types to the kernel functions
 
+    std::vector<double> m_supportVectorMatrix; ///< The support vectors as a dense matrix, stored feature by feature
+    std::vector<double> m_yAlphaVector;        ///< The alpha-value multiplied by the y-value for each support vector
+
     /**
      *  @brief  Read the svm parameters from an xml file
      *
@@ -234,6 +238,26 @@ private:
      */
     double CalculateClassificationScoreImpl(const LArMvaHelper::MvaFeatureVector &features) const;
 
+    /**
+     *  @brief  Get the (standardized) feature values for evaluation of a built-in kernel against the support vector matrix
+     *
+     *  @param  features the vector of features
+     *  @param  featureValues to receive the (standardized) feature values
+     *
+     *  @return whether the support vector matrix can be used, which requires a built-in kernel and a complete, initialized feature vector
+     */
+    bool GetFeatureValues(const LArMvaHelper::MvaFeatureVector &features, std::vector<double> &featureValues) const;
+
+    /**
+     *  @brief  Calculate the classification score by evaluating the built-in kernel against every support vector in the matrix
+     *
+     *  @param  featureValues the (standardized) feature values
+     *  @param  kernelValues workspace to receive the kernel values for each support vector
+     *
+     *  @return the classification score
+     */
+    double CalculateMatrixClassificationScore(const std::vector<double> &featureValues, std::vector<double> &kernelValues) const;
+
     /**
      *  @brief  An inhomogeneous quadratic kernel
      *
@@ -333,6 +357,7 @@ inline unsigned int SupportVectorMachine::GetNFeatures() const
 inline void SupportVectorMachine::SetKernelFunction(KernelFunction kernelFunction)
 {
     m_kernelFunction = std::move(kernelFunction);
+    m_kernelFunctionType = USER_DEFINED;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
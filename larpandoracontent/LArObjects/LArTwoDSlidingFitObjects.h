@@ -104,6 +104,14 @@ public:
      */
     void AddPoint(const float l, const float t);
 
+    /**
+     *  @brief  Remove a point, previously added, from layer fit
+     *
+     *  @param  l the longitudinal coordinate
+     *  @param  t the transverse coordinate
+     */
+    void RemovePoint(const float l, const float t);
+
     /**
      *  @brief  Get the sum t
      *
@@ -352,6 +360,24 @@ inline void LayerFitContribution::AddPoint(const float l, const float t)
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline void LayerFitContribution::RemovePoint(const float l, const float t)
+{
+    if (0 == m_nPoints)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
+
+    const double T = static_cast<double>(t);
+    const double L = static_cast<double>(l);
+
+    m_sumT -= T;
+    m_sumL -= L;
+    m_sumTT -= T * T;
+    m_sumLT -= L * T;
+    m_sumLL -= L * L;
+    --m_nPoints;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline double LayerFitContribution::GetSumT() const
 {
     return m_sumT;
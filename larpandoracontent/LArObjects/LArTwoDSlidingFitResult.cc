@@ -582,6 +582,20 @@ const FitSegment &TwoDSlidingFitResult::GetFitSegment(const float rL) const
     throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDSlidingFitResult::AddPoints(const CartesianPointVector &pointVector)
+{
+    this->UpdateSlidingLinearFit(pointVector, true);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDSlidingFitResult::RemovePoints(const CartesianPointVector &pointVector)
+{
+    this->UpdateSlidingLinearFit(pointVector, false);
+}
+
 // Private member functions start here
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -648,14 +662,29 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
     if ((m_layerPitch < std::numeric_limits<float>::epsilon()) || (m_layerFitContributionMap.empty()))
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
+    this->PerformSlidingLinearFit(m_layerFitContributionMap.begin()->first, m_layerFitContributionMap.rbegin()->first);
+
+    if (m_layerFitResultMap.empty())
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDSlidingFitResult::PerformSlidingLinearFit(const int minLayer, const int maxLayer)
+{
+    if (minLayer > maxLayer)
+        return;
+
+    m_layerFitResultMap.erase(m_layerFitResultMap.lower_bound(minLayer), m_layerFitResultMap.upper_bound(maxLayer));
+
     unsigned int slidingNPoints(0);
     double slidingSumT(0.), slidingSumL(0.), slidingSumTT(0.), slidingSumLT(0.), slidingSumLL(0.);
 
     const LayerFitContributionMap &layerFitContributionMap(this->GetLayerFitContributionMap());
-    const int innerLayer(layerFitContributionMap.begin()->first);
     const int layerFitHalfWindow(static_cast<int>(this->GetLayerFitHalfWindow()));
 
-    for (int iLayer = innerLayer; iLayer < innerLayer + layerFitHalfWindow; ++iLayer)
+    // ATTN Start from the window preceding the first layer to fit, which is empty below the innermost contributing layer
+    for (int iLayer = minLayer - layerFitHalfWindow - 1; iLayer < minLayer + layerFitHalfWindow; ++iLayer)
     {
         LayerFitContributionMap::const_iterator lyrIter = layerFitContributionMap.find(iLayer);
 
@@ -670,9 +699,7 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
         }
     }
 
-    const int outerLayer(layerFitContributionMap.rbegin()->first);
-
-    for (int iLayer = innerLayer; iLayer <= outerLayer; ++iLayer)
+    for (int iLayer = minLayer; iLayer <= maxLayer; ++iLayer)
     {
         const int fwdLayer(iLayer + layerFitHalfWindow);
         LayerFitContributionMap::const_iterator fwdIter = layerFitContributionMap.find(fwdLayer);
@@ -734,9 +761,81 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
         const LayerFitResult layerFitResult(l, fitT, gradient, rms);
         (void)m_layerFitResultMap.insert(LayerFitResultMap::value_type(iLayer, layerFitResult));
     }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TwoDSlidingFitResult::UpdateSlidingLinearFit(const CartesianPointVector &pointVector, const bool isAddition)
+{
+    if (m_layerFitContributionMap.empty() || m_layerFitResultMap.empty())
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    if (pointVector.empty())
+        return;
+
+    typedef std::pair<float, float> LocalPosition;
+    typedef std::vector<std::pair<int, LocalPosition>> LayerPositionVector;
+    typedef std::map<int, unsigned int> LayerCountMap;
+
+    LayerPositionVector layerPositionVector;
+    LayerCountMap layerCountMap;
+
+    for (const CartesianVector &point : pointVector)
+    {
+        float rL(0.f), rT(0.f);
+        this->GetLocalPosition(point, rL, rT);
+
+        const int layer(this->GetLayer(rL));
+        layerPositionVector.push_back(LayerPositionVector::value_type(layer, LocalPosition(rL, rT)));
+        ++layerCountMap[layer];
+    }
+
+    // Check that all points can be removed before modifying the fit
+    if (!isAddition)
+    {
+        for (const LayerCountMap::value_type &mapEntry : layerCountMap)
+        {
+            LayerFitContributionMap::const_iterator contributionIter(m_layerFitContributionMap.find(mapEntry.first));
+
+            if ((m_layerFitContributionMap.end() == contributionIter) || (contributionIter->second.GetNPoints() < mapEntry.second))
+                throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+        }
+    }
+
+    for (const LayerPositionVector::value_type &layerPosition : layerPositionVector)
+    {
+        if (isAddition)
+        {
+            m_layerFitContributionMap[layerPosition.first].AddPoint(layerPosition.second.first, layerPosition.second.second);
+        }
+        else
+        {
+            LayerFitContribution &layerFitContribution(m_layerFitContributionMap.at(layerPosition.first));
+            layerFitContribution.RemovePoint(layerPosition.second.first, layerPosition.second.second);
+
+            // ATTN Drop emptied layers, rather than retaining sums that are zero only up to rounding
+            if (0 == layerFitContribution.GetNPoints())
+                m_layerFitContributionMap.erase(layerPosition.first);
+        }
+    }
+
+    // Layer fit results depend on contributions within a half window, so only those around the modified layers can change
+    const int layerFitHalfWindow(static_cast<int>(this->GetLayerFitHalfWindow()));
+    const int minLayer(layerCountMap.begin()->first - layerFitHalfWindow), maxLayer(layerCountMap.rbegin()->first + layerFitHalfWindow);
+
+    m_layerFitResultMap.erase(m_layerFitResultMap.lower_bound(minLayer), m_layerFitResultMap.upper_bound(maxLayer));
+    m_fitSegmentList.clear();
+
+    if (!m_layerFitContributionMap.empty())
+    {
+        this->PerformSlidingLinearFit(
+            std::max(minLayer, m_layerFitContributionMap.begin()->first), std::min(maxLayer, m_layerFitContributionMap.rbegin()->first));
+    }
 
     if (m_layerFitResultMap.empty())
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    this->FindSlidingFitSegments();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
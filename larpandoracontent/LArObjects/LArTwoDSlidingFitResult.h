@@ -12,6 +12,7 @@
 
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitObjects.h"
 
+#include <memory>
 #include <unordered_map>
 
 namespace lar_content
@@ -398,6 +399,25 @@ public:
      */
     const FitSegment &GetFitSegment(const float rL) const;
 
+    /**
+     *  @brief  Add points to the fit, keeping the fit axes fixed. Only the layer fit results within a half window of the layers that
+     *          receive points are recalculated, before the fit segments are rebuilt from the layer fit results.
+     *
+     *  @param  pointVector the points to add
+     */
+    void AddPoints(const pandora::CartesianPointVector &pointVector);
+
+    /**
+     *  @brief  Remove points, previously added to the fit, keeping the fit axes fixed. Only the layer fit results within a half window
+     *          of the layers that lose points are recalculated, before the fit segments are rebuilt from the layer fit results.
+     *
+     *  @param  pointVector the points to remove
+     *
+     *  @throw  StatusCodeException if a layer holds fewer points than are to be removed from it, in which case the fit is unchanged,
+     *          or if no layer fit results remain
+     */
+    void RemovePoints(const pandora::CartesianPointVector &pointVector);
+
 private:
     /**
      *  @brief  Calculate the longitudinal and transverse axes
@@ -414,6 +434,22 @@ private:
      */
     void PerformSlidingLinearFit();
 
+    /**
+     *  @brief  Perform the sliding linear fit for a range of layers, replacing any existing layer fit results in this range
+     *
+     *  @param  minLayer the minimum layer to fit
+     *  @param  maxLayer the maximum layer to fit
+     */
+    void PerformSlidingLinearFit(const int minLayer, const int maxLayer);
+
+    /**
+     *  @brief  Add or remove points from the layer fit contribution map and update the fit for the affected layers
+     *
+     *  @param  pointVector the points to add or remove
+     *  @param  isAddition whether to add, rather than remove, the points
+     */
+    void UpdateSlidingLinearFit(const pandora::CartesianPointVector &pointVector, const bool isAddition);
+
     /**
      *  @brief  Find sliding fit segments; sections with tramsverse direction
      */
@@ -549,6 +585,9 @@ private:
 
 typedef std::vector<TwoDSlidingFitResult> TwoDSlidingFitResultList;
 typedef std::unordered_map<const pandora::Cluster *, TwoDSlidingFitResult> TwoDSlidingFitResultMap;
+typedef std::shared_ptr<const TwoDSlidingFitResult> TwoDSlidingFitResultPtr;
+typedef std::vector<TwoDSlidingFitResultPtr> TwoDSlidingFitResultPtrList;
+typedef std::unordered_map<const pandora::Cluster *, TwoDSlidingFitResultPtr> TwoDSlidingFitResultPtrMap;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -17,6 +17,7 @@
 #include "larpandoracontent/LArPersistency/EventReadingAlgorithm.h"
 
 #include <algorithm>
+#include <fstream>
 
 using namespace pandora;
 
@@ -28,6 +29,9 @@ EventReadingAlgorithm::EventReadingAlgorithm() :
     m_useLArCaloHits(true),
     m_larCaloHitVersion(1),
     m_useLArMCParticles(true),
+    m_prefetchEventFiles(false),
+    m_nPrefetchedEventFiles(1),
+    m_maxPrefetchedMegabytes(256),
     m_pEventFileReader(nullptr)
 {
 }
@@ -36,6 +40,7 @@ EventReadingAlgorithm::EventReadingAlgorithm() :
 
 EventReadingAlgorithm::~EventReadingAlgorithm()
 {
+    m_pFilePrefetcher.reset();
     delete m_pEventFileReader;
 }
 
@@ -143,11 +148,32 @@ StatusCode EventReadingAlgorithm::ReplaceEventFileReader(const std::string &file
     if (m_useLArMCParticles)
         m_pEventFileReader->SetFactory(new LArMCParticleFactory);
 
+    if (m_prefetchEventFiles)
+        this->StartPrefetching(fileName);
+
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void EventReadingAlgorithm::StartPrefetching(const std::string &fileName)
+{
+    // ATTN Any previous prefetching is abandoned first; the names of the files still to be processed are held in reverse order
+    m_pFilePrefetcher.reset();
+
+    StringVector fileNames(1, fileName);
+
+    for (StringVector::const_reverse_iterator iter = m_eventFileNameVector.rbegin(), iterEnd = m_eventFileNameVector.rend();
+         (iter != iterEnd) && (fileNames.size() <= m_nPrefetchedEventFiles); ++iter)
+    {
+        fileNames.push_back(*iter);
+    }
+
+    m_pFilePrefetcher.reset(new FilePrefetcher(fileNames, static_cast<std::size_t>(m_maxPrefetchedMegabytes) * 1024 * 1024));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 FileType EventReadingAlgorithm::GetFileType(const std::string &fileName) const
 {
     std::string fileExtension(fileName.substr(fileName.find_last_of(".")));
@@ -232,7 +258,60 @@ StatusCode EventReadingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseLArMCParticles", m_useLArMCParticles));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "PrefetchEventFiles", m_prefetchEventFiles));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NPrefetchedEventFiles", m_nPrefetchedEventFiles));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "MaxPrefetchedMegabytes", m_maxPrefetchedMegabytes));
+
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventReadingAlgorithm::FilePrefetcher::FilePrefetcher(const StringVector &fileNames, const std::size_t maxPrefetchedBytes) :
+    m_fileNames(fileNames),
+    m_maxPrefetchedBytes(maxPrefetchedBytes),
+    m_stop(false),
+    m_thread(&FilePrefetcher::Prefetch, this)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+EventReadingAlgorithm::FilePrefetcher::~FilePrefetcher()
+{
+    m_stop = true;
+    m_thread.join();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void EventReadingAlgorithm::FilePrefetcher::Prefetch()
+{
+    // ATTN Files are read in blocks, so that abandoned prefetching stops promptly. Failures are ignored, to be reported by the file reader.
+    // The total read is bounded, so that prefetching neither runs far ahead of the file reader nor evicts the rest of the file cache.
+    const std::size_t blockSize(4 * 1024 * 1024);
+    std::vector<char> buffer(blockSize);
+    std::size_t nRemainingBytes(m_maxPrefetchedBytes);
+
+    for (const std::string &fileName : m_fileNames)
+    {
+        std::ifstream fileStream(fileName, std::ios::in | std::ios::binary);
+
+        while (!m_stop && (nRemainingBytes > 0) && fileStream)
+        {
+            fileStream.read(buffer.data(), std::min(blockSize, nRemainingBytes));
+            nRemainingBytes -= static_cast<std::size_t>(fileStream.gcount());
+        }
+
+        if (m_stop || (0 == nRemainingBytes))
+            return;
+    }
+}
+
 } // namespace lar_content
@@ -14,6 +14,10 @@
 
 #include "Persistency/PandoraIO.h"
 
+#include <atomic>
+#include <memory>
+#include <thread>
+
 namespace pandora
 {
 class FileReader;
@@ -52,6 +56,38 @@ public:
     };
 
 private:
+    /**
+     *  @brief  FilePrefetcher class, reading a list of files in a background thread so that their contents are already held in the
+     *          operating system file cache when they are subsequently read by the event file reader
+     */
+    class FilePrefetcher
+    {
+    public:
+        /**
+         *  @brief  Constructor, starting the background thread
+         *
+         *  @param  fileNames the names of the files to prefetch, in order
+         *  @param  maxPrefetchedBytes the maximum number of bytes to read, in total, across all of the files
+         */
+        FilePrefetcher(const pandora::StringVector &fileNames, const std::size_t maxPrefetchedBytes);
+
+        /**
+         *  @brief  Destructor, abandoning any remaining prefetching and joining the background thread
+         */
+        ~FilePrefetcher();
+
+    private:
+        /**
+         *  @brief  Read each of the files in turn, discarding their contents, until the maximum number of bytes has been read
+         */
+        void Prefetch();
+
+        pandora::StringVector m_fileNames; ///< The names of the files to prefetch
+        std::size_t m_maxPrefetchedBytes;  ///< The maximum number of bytes to read, in total, across all of the files
+        std::atomic<bool> m_stop;          ///< Whether prefetching should be abandoned
+        std::thread m_thread;              ///< The background thread
+    };
+
     pandora::StatusCode Initialize();
     pandora::StatusCode Run();
 
@@ -67,6 +103,13 @@ private:
      */
     pandora::StatusCode ReplaceEventFileReader(const std::string &fileName);
 
+    /**
+     *  @brief  Start prefetching the specified file, followed by the next event files in the input list, up to the maximum prefetch size
+     *
+     *  @param  fileName the file name
+     */
+    void StartPrefetching(const std::string &fileName);
+
     /**
      *  @brief  Analyze a provided file name to extract the file type/extension
      *
@@ -88,7 +131,12 @@ private:
     unsigned int m_larCaloHitVersion; ///< LArCaloHit version for LArCaloHitFactory
     bool m_useLArMCParticles;         ///< Whether to read lar mc particles, or standard pandora mc particles
 
-    pandora::FileReader *m_pEventFileReader; ///< Address of the event file reader
+    bool m_prefetchEventFiles;             ///< Whether to read event files ahead of the event file reader in a background thread
+    unsigned int m_nPrefetchedEventFiles;  ///< The number of event files to prefetch beyond the current event file
+    unsigned int m_maxPrefetchedMegabytes; ///< The maximum data, in MB, prefetched each time an event file is opened, bounding cache use
+
+    pandora::FileReader *m_pEventFileReader;           ///< Address of the event file reader
+    std::unique_ptr<FilePrefetcher> m_pFilePrefetcher; ///< The event file prefetcher
 };
 
 } // namespace lar_content
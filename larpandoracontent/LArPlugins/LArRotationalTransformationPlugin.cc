@@ -16,6 +16,8 @@
 
 #include "Pandora/Pandora.h"
 
+#include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+
 #include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
 
 #include <cmath>
@@ -41,12 +43,21 @@ LArRotationalTransformationPlugin::LArRotationalTransformationPlugin() :
     m_maxAngularDiscrepancyU(0.03),
     m_maxAngularDiscrepancyV(0.03),
     m_maxAngularDiscrepancyW(0.03),
-    m_maxSigmaDiscrepancy(0.01)
+    m_maxSigmaDiscrepancy(0.01),
+    m_pPandora(nullptr)
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+LArRotationalTransformationPlugin::~LArRotationalTransformationPlugin()
+{
+    if (m_pPandora)
+        LArGeometryHelper::ReleaseGeometry(*m_pPandora);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 double LArRotationalTransformationPlugin::UVtoW(const double u, const double v) const
 {
     return (-1. * (u * m_sinWminusV + v * m_sinUminusW) / m_sinVminusU);
@@ -322,6 +333,9 @@ StatusCode LArRotationalTransformationPlugin::Initialize()
         }
     }
 
+    // ATTN Geometry quantities are derived by the helper functions on first use, but must be released with the instance
+    m_pPandora = &this->GetPandora();
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -24,6 +24,11 @@ public:
      */
     LArRotationalTransformationPlugin();
 
+    /**
+     *  @brief  Destructor, releasing the geometry quantities derived for the associated pandora instance
+     */
+    ~LArRotationalTransformationPlugin();
+
     virtual double UVtoW(const double u, const double v) const;
     virtual double VWtoU(const double v, const double w) const;
     virtual double WUtoV(const double w, const double u) const;
@@ -66,6 +71,8 @@ private:
     double m_maxAngularDiscrepancyV; ///< Maximum allowed difference between v wire angles between LArTPCs
     double m_maxAngularDiscrepancyW; ///< Maximum allowed difference between w wire angles between LArTPCs
     double m_maxSigmaDiscrepancy;    ///< Maximum allowed difference between like wire sigma values between LArTPCs
+
+    const pandora::Pandora *m_pPandora; ///< The associated pandora instance, whose derived geometry quantities are released on destruction
 };
 
 } // namespace lar_content
@@ -13,6 +13,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 using namespace pandora;
 
@@ -30,6 +31,14 @@ CosmicRayTrackRecoveryAlgorithm::CosmicRayTrackRecoveryAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode CosmicRayTrackRecoveryAlgorithm::Reset()
+{
+    LArSlidingFitCacheHelper::Reset(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CosmicRayTrackRecoveryAlgorithm::Run()
 {
     // Get the available clusters for each view
@@ -45,7 +54,7 @@ StatusCode CosmicRayTrackRecoveryAlgorithm::Run()
     this->SelectCleanClusters(availableClustersW, cleanClustersW);
 
     // Calculate sliding fit results for clean clusters
-    TwoDSlidingFitResultMap slidingFitResultMap;
+    TwoDSlidingFitResultPtrMap slidingFitResultMap;
     this->BuildSlidingFitResultMap(cleanClustersU, slidingFitResultMap);
     this->BuildSlidingFitResultMap(cleanClustersV, slidingFitResultMap);
     this->BuildSlidingFitResultMap(cleanClustersW, slidingFitResultMap);
@@ -128,7 +137,8 @@ void CosmicRayTrackRecoveryAlgorithm::SelectCleanClusters(const ClusterVector &i
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CosmicRayTrackRecoveryAlgorithm::BuildSlidingFitResultMap(const ClusterVector &clusterVector, TwoDSlidingFitResultMap &slidingFitResultMap) const
+void CosmicRayTrackRecoveryAlgorithm::BuildSlidingFitResultMap(
+    const ClusterVector &clusterVector, TwoDSlidingFitResultPtrMap &slidingFitResultMap) const
 {
     const unsigned int m_halfWindowLayers(25);
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
@@ -139,9 +149,10 @@ void CosmicRayTrackRecoveryAlgorithm::BuildSlidingFitResultMap(const ClusterVect
         {
             try
             {
-                const TwoDSlidingFitResult slidingFitResult(*iter, m_halfWindowLayers, slidingFitPitch);
+                const TwoDSlidingFitResultPtr pSlidingFitResult(
+                    LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), *iter, m_halfWindowLayers, slidingFitPitch));
 
-                if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, slidingFitResult)).second)
+                if (!slidingFitResultMap.insert(TwoDSlidingFitResultPtrMap::value_type(*iter, pSlidingFitResult)).second)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
             }
             catch (StatusCodeException &statusCodeException)
@@ -156,7 +167,7 @@ void CosmicRayTrackRecoveryAlgorithm::BuildSlidingFitResultMap(const ClusterVect
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void CosmicRayTrackRecoveryAlgorithm::MatchViews(const ClusterVector &clusterVector1, const ClusterVector &clusterVector2,
-    const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const
+    const TwoDSlidingFitResultPtrMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const
 {
     for (ClusterVector::const_iterator iter1 = clusterVector1.begin(), iterEnd1 = clusterVector1.end(); iter1 != iterEnd1; ++iter1)
         this->MatchClusters(*iter1, clusterVector2, slidingFitResultMap, clusterAssociationMap);
@@ -168,19 +179,19 @@ void CosmicRayTrackRecoveryAlgorithm::MatchViews(const ClusterVector &clusterVec
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void CosmicRayTrackRecoveryAlgorithm::MatchClusters(const Cluster *const pSeedCluster, const ClusterVector &targetClusters,
-    const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const
+    const TwoDSlidingFitResultPtrMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const
 {
     // Match seed cluster to target clusters according to alignment in X position of start/end positions
     // Two possible matches: (a) one-to-one associations where both the track start and end positions match up
     //                       (b) one-to-two associations where the track is split into two clusters in one view
     // Require overlap in X (according to clusterMinOverlapX) and alignment in X (according to clusterMaxDeltaX)
 
-    TwoDSlidingFitResultMap::const_iterator fsIter = slidingFitResultMap.find(pSeedCluster);
+    TwoDSlidingFitResultPtrMap::const_iterator fsIter = slidingFitResultMap.find(pSeedCluster);
 
     if (slidingFitResultMap.end() == fsIter)
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
-    const TwoDSlidingFitResult &slidingFitResult1(fsIter->second);
+    const TwoDSlidingFitResult &slidingFitResult1(*(fsIter->second));
     const CartesianVector &innerVertex1(slidingFitResult1.GetGlobalMinLayerPosition());
     const CartesianVector &outerVertex1(slidingFitResult1.GetGlobalMaxLayerPosition());
     const float xSpan1(std::fabs(outerVertex1.GetX() - innerVertex1.GetX()));
@@ -206,12 +217,12 @@ void CosmicRayTrackRecoveryAlgorithm::MatchClusters(const Cluster *const pSeedCl
         if (LArClusterHelper::GetClusterHitType(pSeedCluster) == LArClusterHelper::GetClusterHitType(pTargetCluster))
             throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-        TwoDSlidingFitResultMap::const_iterator ftIter = slidingFitResultMap.find(*tIter);
+        TwoDSlidingFitResultPtrMap::const_iterator ftIter = slidingFitResultMap.find(*tIter);
 
         if (slidingFitResultMap.end() == ftIter)
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        const TwoDSlidingFitResult &slidingFitResult2(ftIter->second);
+        const TwoDSlidingFitResult &slidingFitResult2(*(ftIter->second));
         const CartesianVector &innerVertex2(slidingFitResult2.GetGlobalMinLayerPosition());
         const CartesianVector &outerVertex2(slidingFitResult2.GetGlobalMaxLayerPosition());
         const float xSpan2(std::fabs(outerVertex2.GetX() - innerVertex2.GetX()));
@@ -264,14 +275,14 @@ void CosmicRayTrackRecoveryAlgorithm::MatchClusters(const Cluster *const pSeedCl
     }
     else if (pBestClusterInner && pBestClusterOuter)
     {
-        TwoDSlidingFitResultMap::const_iterator iterInner = slidingFitResultMap.find(pBestClusterInner);
-        TwoDSlidingFitResultMap::const_iterator iterOuter = slidingFitResultMap.find(pBestClusterOuter);
+        TwoDSlidingFitResultPtrMap::const_iterator iterInner = slidingFitResultMap.find(pBestClusterInner);
+        TwoDSlidingFitResultPtrMap::const_iterator iterOuter = slidingFitResultMap.find(pBestClusterOuter);
 
         if (slidingFitResultMap.end() == iterInner || slidingFitResultMap.end() == iterOuter)
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        const LArPointingCluster pointingClusterInner(iterInner->second);
-        const LArPointingCluster pointingClusterOuter(iterOuter->second);
+        const LArPointingCluster pointingClusterInner(*(iterInner->second));
+        const LArPointingCluster pointingClusterOuter(*(iterOuter->second));
 
         LArPointingCluster::Vertex pointingVertexInner, pointingVertexOuter;
 
@@ -717,6 +728,8 @@ void CosmicRayTrackRecoveryAlgorithm::MergeClusters(const ClusterList &inputClus
             if (!PandoraContentApi::IsAvailable(*this, pAssociatedCluster))
                 continue;
 
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pSeedCluster);
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pAssociatedCluster);
             PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
                 PandoraContentApi::MergeAndDeleteClusters(*this, pSeedCluster, pAssociatedCluster, inputClusterListName, inputClusterListName));
         }
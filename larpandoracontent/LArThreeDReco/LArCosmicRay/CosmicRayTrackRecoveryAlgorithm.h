@@ -28,6 +28,7 @@ public:
     CosmicRayTrackRecoveryAlgorithm();
 
 private:
+    pandora::StatusCode Reset();
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -66,7 +67,7 @@ private:
      *  @param  clusterVector the input cluster vector
      *  @param  slidingFitResultMap the output sliding fit result map
      */
-    void BuildSlidingFitResultMap(const pandora::ClusterVector &clusterVector, TwoDSlidingFitResultMap &slidingFitResultMap) const;
+    void BuildSlidingFitResultMap(const pandora::ClusterVector &clusterVector, TwoDSlidingFitResultPtrMap &slidingFitResultMap) const;
 
     /**
      *  @brief Match a pair of cluster vectors and populate the cluster association map
@@ -77,7 +78,7 @@ private:
      *  @param clusterAssociationMap the output map of cluster associations
      */
     void MatchViews(const pandora::ClusterVector &clusterVector1, const pandora::ClusterVector &clusterVector2,
-        const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const;
+        const TwoDSlidingFitResultPtrMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const;
 
     /**
      *  @brief Match a seed cluster with a list of target clusters and populate the cluster association map
@@ -88,7 +89,7 @@ private:
      *  @param clusterAssociationMap the output map of cluster associations
      */
     void MatchClusters(const pandora::Cluster *const pSeedCluster, const pandora::ClusterVector &targetClusters,
-        const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const;
+        const TwoDSlidingFitResultPtrMap &slidingFitResultMap, ClusterAssociationMap &clusterAssociationMap) const;
 
     /**
      *  @brief  Create candidate particles using three primary clusters
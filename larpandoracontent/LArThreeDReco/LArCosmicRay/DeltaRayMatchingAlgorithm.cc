@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArCosmicRay/DeltaRayMatchingAlgorithm.h"
 
@@ -709,6 +710,8 @@ void DeltaRayMatchingAlgorithm::AddToDaughterPfo(const ClusterList &clusterList,
 
         const Cluster *const pParentCluster = *(pfoClusters.begin());
 
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pParentCluster);
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pDaughterCluster);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
             PandoraContentApi::MergeAndDeleteClusters(*this, pParentCluster, pDaughterCluster, clusterListName, clusterListName));
     }
@@ -20,6 +20,9 @@
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <algorithm>
+#include <cmath>
+
 using namespace pandora;
 
 namespace lar_content
@@ -205,6 +208,33 @@ void EventSlicingTool::GetClusterSliceList(const ClusterList &trackClusters3D, c
     sortedClusters3D.insert(sortedClusters3D.end(), showerClusters3D.begin(), showerClusters3D.end());
     std::sort(sortedClusters3D.begin(), sortedClusters3D.end(), LArClusterHelper::SortByNHits);
 
+    AssociationCache associationCache;
+    associationCache.m_maxVertexSeparation = this->GetMaxVertexSeparation();
+
+    // Index the hits in all candidate clusters, so that proximity association need not compare every pair of hits
+    CaloHitList caloHitList3D;
+
+    if (m_useProximityAssociation)
+    {
+        for (const Cluster *const pCluster3D : sortedClusters3D)
+        {
+            CaloHitList clusterCaloHitList;
+            pCluster3D->GetOrderedCaloHitList().FillCaloHitList(clusterCaloHitList);
+
+            for (const CaloHit *const pCaloHit : clusterCaloHitList)
+            {
+                caloHitList3D.push_back(pCaloHit);
+                (void)associationCache.m_hitToClusterMap.insert(HitToClusterMap::value_type(pCaloHit, pCluster3D));
+            }
+        }
+    }
+
+    HitKDNode3DList kDNode3DList;
+    KDTreeCube boundingRegion3D(fill_and_bound_3d_kd_tree(caloHitList3D, kDNode3DList));
+
+    HitKDTree3D kdTree;
+    kdTree.build(kDNode3DList, boundingRegion3D);
+
     ClusterSet usedClusters;
 
     for (const Cluster *const pCluster3D : sortedClusters3D)
@@ -219,16 +249,22 @@ void EventSlicingTool::GetClusterSliceList(const ClusterList &trackClusters3D, c
         usedClusters.insert(pCluster3D);
 
         ClusterVector &clusterSlice(clusterSliceList.back());
-        this->CollectAssociatedClusters(pCluster3D, sortedClusters3D, trackFitResults, showerConeFitResults, clusterSlice, usedClusters);
+        this->CollectAssociatedClusters(
+            pCluster3D, sortedClusters3D, trackFitResults, showerConeFitResults, kdTree, associationCache, clusterSlice, usedClusters);
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void EventSlicingTool::CollectAssociatedClusters(const Cluster *const pClusterInSlice, const ClusterVector &candidateClusters,
-    const ThreeDSlidingFitResultMap &trackFitResults, const ThreeDSlidingConeFitResultMap &showerConeFitResults,
-    ClusterVector &clusterSlice, ClusterSet &usedClusters) const
+    const ThreeDSlidingFitResultMap &trackFitResults, const ThreeDSlidingConeFitResultMap &showerConeFitResults, const HitKDTree3D &kdTree,
+    AssociationCache &associationCache, ClusterVector &clusterSlice, ClusterSet &usedClusters) const
 {
+    ClusterSet proximalClusters;
+
+    if (m_useProximityAssociation)
+        this->GetProximalClusters(pClusterInSlice, kdTree, associationCache, proximalClusters);
+
     ClusterVector addedClusters;
 
     for (const Cluster *const pCandidateCluster : candidateClusters)
@@ -236,10 +272,11 @@ void EventSlicingTool::CollectAssociatedClusters(const Cluster *const pClusterIn
         if (usedClusters.count(pCandidateCluster) || (pClusterInSlice == pCandidateCluster))
             continue;
 
-        if ((m_usePointingAssociation && this->PassPointing(pClusterInSlice, pCandidateCluster, trackFitResults)) ||
-            (m_useProximityAssociation && this->PassProximity(pClusterInSlice, pCandidateCluster)) ||
-            (m_useShowerConeAssociation && (this->PassShowerCone(pClusterInSlice, pCandidateCluster, showerConeFitResults) ||
-                                               this->PassShowerCone(pCandidateCluster, pClusterInSlice, showerConeFitResults))))
+        if ((m_usePointingAssociation && this->PassPointing(pClusterInSlice, pCandidateCluster, trackFitResults, associationCache)) ||
+            (m_useProximityAssociation && proximalClusters.count(pCandidateCluster)) ||
+            (m_useShowerConeAssociation &&
+                (this->PassShowerCone(pClusterInSlice, pCandidateCluster, showerConeFitResults, associationCache) ||
+                    this->PassShowerCone(pCandidateCluster, pClusterInSlice, showerConeFitResults, associationCache))))
         {
             addedClusters.push_back(pCandidateCluster);
             (void)usedClusters.insert(pCandidateCluster);
@@ -249,13 +286,16 @@ void EventSlicingTool::CollectAssociatedClusters(const Cluster *const pClusterIn
     clusterSlice.insert(clusterSlice.end(), addedClusters.begin(), addedClusters.end());
 
     for (const Cluster *const pAddedCluster : addedClusters)
-        this->CollectAssociatedClusters(pAddedCluster, candidateClusters, trackFitResults, showerConeFitResults, clusterSlice, usedClusters);
+    {
+        this->CollectAssociatedClusters(
+            pAddedCluster, candidateClusters, trackFitResults, showerConeFitResults, kdTree, associationCache, clusterSlice, usedClusters);
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool EventSlicingTool::PassPointing(
-    const Cluster *const pClusterInSlice, const Cluster *const pCandidateCluster, const ThreeDSlidingFitResultMap &trackFitResults) const
+bool EventSlicingTool::PassPointing(const Cluster *const pClusterInSlice, const Cluster *const pCandidateCluster,
+    const ThreeDSlidingFitResultMap &trackFitResults, AssociationCache &associationCache) const
 {
     ThreeDSlidingFitResultMap::const_iterator inSliceIter = trackFitResults.find(pClusterInSlice);
     ThreeDSlidingFitResultMap::const_iterator candidateIter = trackFitResults.find(pCandidateCluster);
@@ -263,8 +303,11 @@ bool EventSlicingTool::PassPointing(
     if ((trackFitResults.end() == inSliceIter) || (trackFitResults.end() == candidateIter))
         return false;
 
-    const LArPointingCluster inSlicePointingCluster(inSliceIter->second);
-    const LArPointingCluster candidatePointingCluster(candidateIter->second);
+    const LArPointingCluster &inSlicePointingCluster(this->GetPointingCluster(inSliceIter->second, associationCache));
+    const LArPointingCluster &candidatePointingCluster(this->GetPointingCluster(candidateIter->second, associationCache));
+
+    if (!this->HasNearbyVertices(inSlicePointingCluster, candidatePointingCluster, associationCache.m_maxVertexSeparation))
+        return false;
 
     if (this->CheckClosestApproach(inSlicePointingCluster, candidatePointingCluster) ||
         this->IsEmission(inSlicePointingCluster, candidatePointingCluster) || this->IsNode(inSlicePointingCluster, candidatePointingCluster))
@@ -277,64 +320,148 @@ bool EventSlicingTool::PassPointing(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool EventSlicingTool::PassProximity(const Cluster *const pClusterInSlice, const Cluster *const pCandidateCluster) const
+void EventSlicingTool::GetProximalClusters(
+    const Cluster *const pClusterInSlice, const HitKDTree3D &kdTree, const AssociationCache &associationCache, ClusterSet &proximalClusters) const
 {
+    if (!(m_maxHitSeparationSquared > 0.f))
+        return;
+
+    // ATTN Search a slightly enlarged sphere, so that rounding cannot exclude any hit passing the separation cut
+    const float searchDistance(1.001f * std::sqrt(m_maxHitSeparationSquared) + 0.01f);
+
     for (const auto &orderedList1 : pClusterInSlice->GetOrderedCaloHitList())
     {
         for (const CaloHit *const pCaloHit1 : *(orderedList1.second))
         {
             const CartesianVector &positionVector1(pCaloHit1->GetPositionVector());
 
-            for (const auto &orderedList2 : pCandidateCluster->GetOrderedCaloHitList())
+            const HitKDNode3D queryNode(pCaloHit1, positionVector1.GetX(), positionVector1.GetY(), positionVector1.GetZ());
+
+            HitKDNode3DList found;
+            kdTree.searchRadius(queryNode, searchDistance, found);
+
+            for (const HitKDNode3D &hitNode : found)
             {
-                for (const CaloHit *const pCaloHit2 : *(orderedList2.second))
-                {
-                    if ((positionVector1 - pCaloHit2->GetPositionVector()).GetMagnitudeSquared() < m_maxHitSeparationSquared)
-                        return true;
-                }
+                const Cluster *const pCandidateCluster(associationCache.m_hitToClusterMap.at(hitNode.data));
+
+                if ((pClusterInSlice == pCandidateCluster) || proximalClusters.count(pCandidateCluster))
+                    continue;
+
+                if ((positionVector1 - hitNode.data->GetPositionVector()).GetMagnitudeSquared() < m_maxHitSeparationSquared)
+                    (void)proximalClusters.insert(pCandidateCluster);
             }
         }
     }
-
-    return false;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool EventSlicingTool::PassShowerCone(
-    const Cluster *const pConeCluster, const Cluster *const pNearbyCluster, const ThreeDSlidingConeFitResultMap &showerConeFitResults) const
+bool EventSlicingTool::PassShowerCone(const Cluster *const pConeCluster, const Cluster *const pNearbyCluster,
+    const ThreeDSlidingConeFitResultMap &showerConeFitResults, AssociationCache &associationCache) const
 {
     ThreeDSlidingConeFitResultMap::const_iterator fitIter = showerConeFitResults.find(pConeCluster);
 
     if (showerConeFitResults.end() == fitIter)
         return false;
 
-    float clusterLength(0.f);
-    SimpleConeList simpleConeList;
+    const ShowerCones &showerCones(this->GetShowerCones(fitIter->second, associationCache));
+    const float coneLength(showerCones.m_coneLength);
+
+    for (const SimpleCone &simpleCone : showerCones.m_simpleConeList)
+    {
+        // ATTN A cone bounds none of the hits of a cluster beyond its reach, so fails any positive bounded fraction cut
+        if ((m_coneBoundedFraction1 > 0.f) && this->IsBeyondCone(simpleCone, coneLength, m_coneTanHalfAngle1, pNearbyCluster, associationCache))
+            continue;
+
+        if (simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle1) < m_coneBoundedFraction1)
+            continue;
+
+        if ((m_coneBoundedFraction2 > 0.f) && this->IsBeyondCone(simpleCone, coneLength, m_coneTanHalfAngle2, pNearbyCluster, associationCache))
+            continue;
+
+        if (simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle2) < m_coneBoundedFraction2)
+            continue;
+
+        return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArPointingCluster &EventSlicingTool::GetPointingCluster(
+    const ThreeDSlidingFitResult &slidingFitResult, AssociationCache &associationCache) const
+{
+    const Cluster *const pCluster(slidingFitResult.GetCluster());
+    PointingClusterMap::const_iterator iter(associationCache.m_pointingClusterMap.find(pCluster));
+
+    if (associationCache.m_pointingClusterMap.end() == iter)
+        iter = associationCache.m_pointingClusterMap.insert(PointingClusterMap::value_type(pCluster, LArPointingCluster(slidingFitResult))).first;
+
+    return iter->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const EventSlicingTool::ShowerCones &EventSlicingTool::GetShowerCones(
+    const ThreeDSlidingConeFitResult &slidingConeFitResult3D, AssociationCache &associationCache) const
+{
+    const ThreeDSlidingFitResult &slidingFitResult3D(slidingConeFitResult3D.GetSlidingFitResult());
+    const Cluster *const pCluster(slidingFitResult3D.GetCluster());
+    ShowerConesMap::const_iterator iter(associationCache.m_showerConesMap.find(pCluster));
+
+    if (associationCache.m_showerConesMap.end() != iter)
+        return iter->second;
+
+    ShowerCones showerCones;
 
     try
     {
-        const ThreeDSlidingConeFitResult &slidingConeFitResult3D(fitIter->second);
-        const ThreeDSlidingFitResult &slidingFitResult3D(slidingConeFitResult3D.GetSlidingFitResult());
-        slidingConeFitResult3D.GetSimpleConeList(m_nConeFitLayers, m_nConeFits, CONE_BOTH_DIRECTIONS, simpleConeList);
-        clusterLength = (slidingFitResult3D.GetGlobalMaxLayerPosition() - slidingFitResult3D.GetGlobalMinLayerPosition()).GetMagnitude();
+        slidingConeFitResult3D.GetSimpleConeList(m_nConeFitLayers, m_nConeFits, CONE_BOTH_DIRECTIONS, showerCones.m_simpleConeList);
+        const float clusterLength((slidingFitResult3D.GetGlobalMaxLayerPosition() - slidingFitResult3D.GetGlobalMinLayerPosition()).GetMagnitude());
+        showerCones.m_coneLength = std::min(m_coneLengthMultiplier * clusterLength, m_maxConeLength);
     }
     catch (const StatusCodeException &)
     {
-        return false;
+        showerCones.m_simpleConeList.clear();
+        showerCones.m_coneLength = 0.f;
     }
 
-    for (const SimpleCone &simpleCone : simpleConeList)
-    {
-        const float coneLength(std::min(m_coneLengthMultiplier * clusterLength, m_maxConeLength));
+    return associationCache.m_showerConesMap.insert(ShowerConesMap::value_type(pCluster, showerCones)).first->second;
+}
 
-        if (simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle1) < m_coneBoundedFraction1)
-            continue;
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-        if (simpleCone.GetBoundedHitFraction(pNearbyCluster, coneLength, m_coneTanHalfAngle2) < m_coneBoundedFraction2)
-            continue;
+float EventSlicingTool::GetMaxVertexSeparation() const
+{
+    // Each check compares a vertex of one cluster with a vertex of the other, using unit vertex directions
+    const float closestApproachSeparation(2.f * std::fabs(m_maxInterceptDistance) + std::fabs(m_maxClosestApproach));
+    const float nodeSeparation(std::fabs(m_minVertexLongitudinalDistance) + std::fabs(m_maxVertexTransverseDistance));
+    const float maxLongitudinalDistance(std::max(std::fabs(m_minVertexLongitudinalDistance), std::fabs(m_maxVertexLongitudinalDistance)));
+    const float tanTheta(std::fabs(std::tan(M_PI * m_vertexAngularAllowance / 180.f)));
+    const float emissionSeparation(maxLongitudinalDistance * (1.f + tanTheta) + std::fabs(m_maxVertexTransverseDistance));
+    const float maxSeparation(std::max(closestApproachSeparation, std::max(nodeSeparation, emissionSeparation)));
+
+    return (std::isfinite(maxSeparation) ? 1.01f * maxSeparation + 1.f : std::numeric_limits<float>::max());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
 
+bool EventSlicingTool::HasNearbyVertices(const LArPointingCluster &cluster1, const LArPointingCluster &cluster2, const float maxSeparation) const
+{
+    if (!(maxSeparation < std::numeric_limits<float>::max()))
         return true;
+
+    const float maxSeparationSquared(maxSeparation * maxSeparation);
+
+    for (const LArPointingCluster::Vertex *const pVertex1 : {&cluster1.GetInnerVertex(), &cluster1.GetOuterVertex()})
+    {
+        for (const LArPointingCluster::Vertex *const pVertex2 : {&cluster2.GetInnerVertex(), &cluster2.GetOuterVertex()})
+        {
+            if (!((pVertex1->GetPosition() - pVertex2->GetPosition()).GetMagnitudeSquared() > maxSeparationSquared))
+                return true;
+        }
     }
 
     return false;
@@ -342,6 +469,39 @@ bool EventSlicingTool::PassShowerCone(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool EventSlicingTool::IsBeyondCone(const SimpleCone &simpleCone, const float coneLength, const float coneTanHalfAngle,
+    const Cluster *const pCluster, AssociationCache &associationCache) const
+{
+    // Bounded hits lie within the cone length along the cone direction and the cone length times tan half angle across it
+    const float directionMagnitude(simpleCone.GetConeDirection().GetMagnitude());
+    const float coneReach(std::fabs(coneLength) * std::sqrt(1.f + coneTanHalfAngle * coneTanHalfAngle) / directionMagnitude);
+
+    if (!std::isfinite(coneReach))
+        return false;
+
+    BoundingBoxMap::const_iterator iter(associationCache.m_boundingBoxMap.find(pCluster));
+
+    if (associationCache.m_boundingBoxMap.end() == iter)
+    {
+        CartesianVector minimumCoordinate(0.f, 0.f, 0.f), maximumCoordinate(0.f, 0.f, 0.f);
+        LArClusterHelper::GetClusterBoundingBox(pCluster, minimumCoordinate, maximumCoordinate);
+        iter = associationCache.m_boundingBoxMap
+                   .insert(BoundingBoxMap::value_type(pCluster, std::make_pair(minimumCoordinate, maximumCoordinate)))
+                   .first;
+    }
+
+    const CartesianVector &apex(simpleCone.GetConeApex());
+    const CartesianVector &minimumCoordinate(iter->second.first), &maximumCoordinate(iter->second.second);
+    const float dx(std::max(0.f, std::max(minimumCoordinate.GetX() - apex.GetX(), apex.GetX() - maximumCoordinate.GetX())));
+    const float dy(std::max(0.f, std::max(minimumCoordinate.GetY() - apex.GetY(), apex.GetY() - maximumCoordinate.GetY())));
+    const float dz(std::max(0.f, std::max(minimumCoordinate.GetZ() - apex.GetZ(), apex.GetZ() - maximumCoordinate.GetZ())));
+    const float maxReach(1.01f * coneReach + 1.f);
+
+    return (dx * dx + dy * dy + dz * dz > maxReach * maxReach);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool EventSlicingTool::CheckClosestApproach(const LArPointingCluster &cluster1, const LArPointingCluster &cluster2) const
 {
     return (this->CheckClosestApproach(cluster1.GetInnerVertex(), cluster2.GetInnerVertex()) ||
@@ -664,7 +824,7 @@ void EventSlicingTool::GetKDTreeEntries3D(const ClusterToSliceIndexMap &clusterT
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-const EventSlicingTool::PointKDNode2D *EventSlicingTool::MatchClusterToSlice(const Cluster *const pCluster2D, PointKDTree2D &kdTree) const
+const EventSlicingTool::PointKDNode2D *EventSlicingTool::MatchClusterToSlice(const Cluster *const pCluster2D, const PointKDTree2D &kdTree) const
 {
     PointList clusterPointList;
     const PointKDNode2D *pBestResultPoint(nullptr);
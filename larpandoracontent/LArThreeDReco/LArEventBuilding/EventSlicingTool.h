@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArControlFlow/SlicingAlgorithm.h"
 
+#include "larpandoracontent/LArObjects/LArPointingCluster.h"
 #include "larpandoracontent/LArObjects/LArThreeDSlidingConeFitResult.h"
 
 #include <unordered_map>
@@ -77,6 +78,38 @@ private:
     void GetClusterSliceList(
         const pandora::ClusterList &trackClusters3D, const pandora::ClusterList &showerClusters3D, ClusterSliceList &clusterSliceList) const;
 
+    typedef KDTreeLinkerAlgo<const pandora::CaloHit *, 3> HitKDTree3D;
+    typedef KDTreeNodeInfoT<const pandora::CaloHit *, 3> HitKDNode3D;
+    typedef std::vector<HitKDNode3D> HitKDNode3DList;
+
+    /**
+     *  @brief  ShowerCones class, holding the cones fitted to a 3D shower cluster
+     */
+    class ShowerCones
+    {
+    public:
+        SimpleConeList m_simpleConeList; ///< The cones, empty if the cone fits failed
+        float m_coneLength;              ///< The cone length to use when calculating bounded cluster fractions
+    };
+
+    typedef std::unordered_map<const pandora::Cluster *, LArPointingCluster> PointingClusterMap;
+    typedef std::unordered_map<const pandora::Cluster *, ShowerCones> ShowerConesMap;
+    typedef std::unordered_map<const pandora::Cluster *, std::pair<pandora::CartesianVector, pandora::CartesianVector>> BoundingBoxMap;
+    typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
+
+    /**
+     *  @brief  AssociationCache class, holding the quantities reused when testing each 3D cluster for association with many others
+     */
+    class AssociationCache
+    {
+    public:
+        float m_maxVertexSeparation;             ///< The max separation of pointing cluster vertices that can pass any pointing check
+        HitToClusterMap m_hitToClusterMap;       ///< The mapping from the hits in the kd tree to their parent 3D clusters
+        PointingClusterMap m_pointingClusterMap; ///< The pointing clusters for track clusters, calculated on first use
+        ShowerConesMap m_showerConesMap;         ///< The cones for shower clusters, calculated on first use
+        BoundingBoxMap m_boundingBoxMap;         ///< The (minimum, maximum) hit coordinates for clusters, calculated on first use
+    };
+
     /**
      *  @brief  Collect all clusters associated with a provided cluster
      *
@@ -84,12 +117,14 @@ private:
      *  @param  candidateClusters the list of candidate clusters
      *  @param  trackFitResults the map of sliding fit results for track candidate clusters
      *  @param  showerConeFitResults the map of sliding const fit results for shower candidate clusters
+     *  @param  kdTree the kd tree holding the hits in the candidate clusters
+     *  @param  associationCache the association cache
      *  @param  clusterSlice the cluster slice
      *  @param  usedClusters the list of clusters already added to slices
      */
     void CollectAssociatedClusters(const pandora::Cluster *const pClusterInSlice, const pandora::ClusterVector &candidateClusters,
-        const ThreeDSlidingFitResultMap &trackFitResults, const ThreeDSlidingConeFitResultMap &showerConeFitResults,
-        pandora::ClusterVector &clusterSlice, pandora::ClusterSet &usedClusters) const;
+        const ThreeDSlidingFitResultMap &trackFitResults, const ThreeDSlidingConeFitResultMap &showerConeFitResults, const HitKDTree3D &kdTree,
+        AssociationCache &associationCache, pandora::ClusterVector &clusterSlice, pandora::ClusterSet &usedClusters) const;
 
     /**
      *  @brief  Compare the provided clusters to assess whether they are associated via pointing (checks association "both ways")
@@ -97,21 +132,24 @@ private:
      *  @param  pClusterInSlice address of a cluster already in the slice
      *  @param  pCandidateCluster address of the candidate cluster
      *  @param  trackFitResults the map of sliding fit results for track candidate clusters
+     *  @param  associationCache the association cache
      *
      *  @return whether an addition to the cluster slice should be made
      */
     bool PassPointing(const pandora::Cluster *const pClusterInSlice, const pandora::Cluster *const pCandidateCluster,
-        const ThreeDSlidingFitResultMap &trackFitResults) const;
+        const ThreeDSlidingFitResultMap &trackFitResults, AssociationCache &associationCache) const;
 
     /**
-     *  @brief  Compare the provided clusters to assess whether they are associated via pointing
+     *  @brief  Find the clusters associated with a provided cluster via proximity, i.e. with a hit within the max hit separation of
+     *          any of its hits
      *
      *  @param  pClusterInSlice address of a cluster already in the slice
-     *  @param  pCandidateCluster address of the candidate cluster
-     *
-     *  @return whether an addition to the cluster slice should be made
+     *  @param  kdTree the kd tree holding the hits in the candidate clusters
+     *  @param  associationCache the association cache
+     *  @param  proximalClusters to receive the clusters associated via proximity
      */
-    bool PassProximity(const pandora::Cluster *const pClusterInSlice, const pandora::Cluster *const pCandidateCluster) const;
+    void GetProximalClusters(const pandora::Cluster *const pClusterInSlice, const HitKDTree3D &kdTree, const AssociationCache &associationCache,
+        pandora::ClusterSet &proximalClusters) const;
 
     /**
      *  @brief  Compare the provided clusters to assess whether they are associated via cone fits to the shower cluster (single "direction" check)
@@ -119,11 +157,65 @@ private:
      *  @param  pClusterInSlice address of a cluster already in the slice
      *  @param  pCandidateCluster address of the candidate cluster
      *  @param  showerConeFitResults the map of sliding cone fit results for shower candidate clusters
+     *  @param  associationCache the association cache
      *
      *  @return whether an addition to the cluster slice should be made
      */
     bool PassShowerCone(const pandora::Cluster *const pConeCluster, const pandora::Cluster *const pNearbyCluster,
-        const ThreeDSlidingConeFitResultMap &showerConeFitResults) const;
+        const ThreeDSlidingConeFitResultMap &showerConeFitResults, AssociationCache &associationCache) const;
+
+    /**
+     *  @brief  Get the pointing cluster for a track cluster, calculating it on first request
+     *
+     *  @param  slidingFitResult the sliding fit result for the track cluster
+     *  @param  associationCache the association cache
+     *
+     *  @return the pointing cluster
+     */
+    const LArPointingCluster &GetPointingCluster(const ThreeDSlidingFitResult &slidingFitResult, AssociationCache &associationCache) const;
+
+    /**
+     *  @brief  Get the cones for a shower cluster, calculating them on first request
+     *
+     *  @param  slidingConeFitResult3D the sliding cone fit result for the shower cluster
+     *  @param  associationCache the association cache
+     *
+     *  @return the shower cones
+     */
+    const ShowerCones &GetShowerCones(const ThreeDSlidingConeFitResult &slidingConeFitResult3D, AssociationCache &associationCache) const;
+
+    /**
+     *  @brief  Get the max separation of the vertices of two pointing clusters that could pass any of the pointing checks, allowing
+     *          for rounding
+     *
+     *  @return the max vertex separation
+     */
+    float GetMaxVertexSeparation() const;
+
+    /**
+     *  @brief  Whether any vertex of one pointing cluster lies within a specified distance of any vertex of another
+     *
+     *  @param  cluster1 the first pointing cluster
+     *  @param  cluster2 the second pointing cluster
+     *  @param  maxSeparation the max vertex separation
+     *
+     *  @return boolean
+     */
+    bool HasNearbyVertices(const LArPointingCluster &cluster1, const LArPointingCluster &cluster2, const float maxSeparation) const;
+
+    /**
+     *  @brief  Whether all hits of a cluster lie beyond the reach of a cone, so that the cone can bound none of them
+     *
+     *  @param  simpleCone the cone
+     *  @param  coneLength the cone length
+     *  @param  coneTanHalfAngle the cone tan half angle
+     *  @param  pCluster address of the cluster
+     *  @param  associationCache the association cache
+     *
+     *  @return boolean
+     */
+    bool IsBeyondCone(const SimpleCone &simpleCone, const float coneLength, const float coneTanHalfAngle, const pandora::Cluster *const pCluster,
+        AssociationCache &associationCache) const;
 
     /**
      *  @brief  Check closest approach metrics for a pair of pointing clusters
@@ -259,7 +351,7 @@ private:
      *
      *  @return the nearest-neighbour point identified by the kd tree
      */
-    const PointKDNode2D *MatchClusterToSlice(const pandora::Cluster *const pCluster2D, PointKDTree2D &kdTree) const;
+    const PointKDNode2D *MatchClusterToSlice(const pandora::Cluster *const pCluster2D, const PointKDTree2D &kdTree) const;
 
     /**
      *  @brief  Sort points (use Z, followed by X, followed by Y)
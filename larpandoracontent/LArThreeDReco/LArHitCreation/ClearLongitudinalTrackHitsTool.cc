@@ -39,7 +39,7 @@ void ClearLongitudinalTrackHitsTool::GetLongitudinalTrackHit3D(
     MatchedSlidingFitMap::const_iterator fIter1 = matchedSlidingFitMap.find(hitType1);
     if (matchedSlidingFitMap.end() != fIter1)
     {
-        const TwoDSlidingFitResult &fitResult1 = fIter1->second;
+        const TwoDSlidingFitResult &fitResult1 = *(fIter1->second);
         const CartesianVector position2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), projection3D, hitType1));
 
         float rL1(0.f), rT1(0.f);
@@ -57,7 +57,7 @@ void ClearLongitudinalTrackHitsTool::GetLongitudinalTrackHit3D(
     MatchedSlidingFitMap::const_iterator fIter2 = matchedSlidingFitMap.find(hitType2);
     if (matchedSlidingFitMap.end() != fIter2)
     {
-        const TwoDSlidingFitResult &fitResult2 = fIter2->second;
+        const TwoDSlidingFitResult &fitResult2 = *(fIter2->second);
         const CartesianVector position2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), projection3D, hitType2));
 
         float rL2(0.f), rT2(0.f);
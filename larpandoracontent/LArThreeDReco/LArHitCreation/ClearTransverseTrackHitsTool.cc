@@ -27,7 +27,7 @@ void ClearTransverseTrackHitsTool::GetTransverseTrackHit3D(const MatchedSlidingF
     MatchedSlidingFitMap::const_iterator fIter1 = matchedSlidingFitMap.find(hitType1);
     if (matchedSlidingFitMap.end() != fIter1)
     {
-        const TwoDSlidingFitResult &fitResult1 = fIter1->second;
+        const TwoDSlidingFitResult &fitResult1 = *(fIter1->second);
         CartesianVector position1(0.f, 0.f, 0.f);
         const StatusCode statusCode(fitResult1.GetExtrapolatedPositionAtX(pCaloHit2D->GetPositionVector().GetX(), position1));
 
@@ -41,7 +41,7 @@ void ClearTransverseTrackHitsTool::GetTransverseTrackHit3D(const MatchedSlidingF
     MatchedSlidingFitMap::const_iterator fIter2 = matchedSlidingFitMap.find(hitType2);
     if (matchedSlidingFitMap.end() != fIter2)
     {
-        const TwoDSlidingFitResult &fitResult2 = fIter2->second;
+        const TwoDSlidingFitResult &fitResult2 = *(fIter2->second);
         CartesianVector position2(0.f, 0.f, 0.f);
         const StatusCode statusCode(fitResult2.GetExtrapolatedPositionAtX(pCaloHit2D->GetPositionVector().GetX(), position2));
 
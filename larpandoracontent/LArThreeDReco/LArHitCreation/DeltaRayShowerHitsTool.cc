@@ -15,6 +15,8 @@
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/DeltaRayShowerHitsTool.h"
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/ThreeDHitCreationAlgorithm.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -54,6 +56,9 @@ void DeltaRayShowerHitsTool::Run(ThreeDHitCreationAlgorithm *const pAlgorithm, c
 void DeltaRayShowerHitsTool::CreateDeltaRayShowerHits3D(
     const CaloHitVector &inputTwoDHits, const CaloHitVector &parentHits3D, ProtoHitVector &protoHitVector) const
 {
+    // Project the parent hits into each view once, rather than once per input hit
+    ProjectedParentHitsMap projectedParentHitsMap;
+
     for (const CaloHit *const pCaloHit2D : inputTwoDHits)
     {
         try
@@ -62,27 +67,21 @@ void DeltaRayShowerHitsTool::CreateDeltaRayShowerHits3D(
             const HitType hitType1((TPC_VIEW_U == hitType) ? TPC_VIEW_V : (TPC_VIEW_V == hitType) ? TPC_VIEW_W : TPC_VIEW_U);
             const HitType hitType2((TPC_VIEW_U == hitType) ? TPC_VIEW_W : (TPC_VIEW_V == hitType) ? TPC_VIEW_U : TPC_VIEW_V);
 
-            bool foundClosestPosition(false);
-            float closestDistanceSquared(std::numeric_limits<float>::max());
-            CartesianVector closestPosition3D(0.f, 0.f, 0.f);
+            ProjectedParentHitsMap::const_iterator iter(projectedParentHitsMap.find(hitType));
 
-            for (const CaloHit *const pCaloHit3D : parentHits3D)
+            if (projectedParentHitsMap.end() == iter)
             {
-                const CartesianVector thisPosition3D(pCaloHit3D->GetPositionVector());
-                const CartesianVector thisPosition2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), thisPosition3D, hitType));
-                const float thisDistanceSquared((pCaloHit2D->GetPositionVector() - thisPosition2D).GetMagnitudeSquared());
-
-                if (thisDistanceSquared < closestDistanceSquared)
-                {
-                    foundClosestPosition = true;
-                    closestDistanceSquared = thisDistanceSquared;
-                    closestPosition3D = thisPosition3D;
-                }
+                std::unique_ptr<const ProjectedParentHits> pProjectedParentHits(
+                    std::make_unique<const ProjectedParentHits>(this->GetPandora(), parentHits3D, hitType));
+                iter = projectedParentHitsMap.emplace(hitType, std::move(pProjectedParentHits)).first;
             }
 
-            if (!foundClosestPosition)
+            unsigned int closestIndex(0);
+
+            if (!iter->second->GetClosestParentHit(pCaloHit2D->GetPositionVector(), closestIndex))
                 continue;
 
+            const CartesianVector closestPosition3D(parentHits3D.at(closestIndex)->GetPositionVector());
             const CartesianVector position1(LArGeometryHelper::ProjectPosition(this->GetPandora(), closestPosition3D, hitType1));
             const CartesianVector position2(LArGeometryHelper::ProjectPosition(this->GetPandora(), closestPosition3D, hitType2));
 
@@ -98,4 +97,66 @@ void DeltaRayShowerHitsTool::CreateDeltaRayShowerHits3D(
     }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+DeltaRayShowerHitsTool::ProjectedParentHits::ProjectedParentHits(const Pandora &pandora, const CaloHitVector &parentHits3D, const HitType hitType)
+{
+    for (const CaloHit *const pCaloHit3D : parentHits3D)
+    {
+        m_xOrderedIndices.push_back(m_projectedPositions.size());
+        m_projectedPositions.push_back(LArGeometryHelper::ProjectPosition(pandora, pCaloHit3D->GetPositionVector(), hitType));
+    }
+
+    std::stable_sort(m_xOrderedIndices.begin(), m_xOrderedIndices.end(), [this](const unsigned int lhs, const unsigned int rhs) {
+        return (m_projectedPositions.at(lhs).GetX() < m_projectedPositions.at(rhs).GetX());
+    });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool DeltaRayShowerHitsTool::ProjectedParentHits::GetClosestParentHit(const CartesianVector &position2D, unsigned int &closestIndex) const
+{
+    bool foundClosestPosition(false);
+    float closestDistanceSquared(std::numeric_limits<float>::max());
+
+    // Search outwards in x from the specified position, stopping in each direction once the x separation alone exceeds the closest distance
+    const std::vector<unsigned int>::const_iterator startIter(std::lower_bound(m_xOrderedIndices.begin(), m_xOrderedIndices.end(),
+        position2D.GetX(), [this](const unsigned int index, const float x) { return (m_projectedPositions.at(index).GetX() < x); }));
+
+    auto considerIndex = [&](const unsigned int index) -> bool {
+        const CartesianVector &thisPosition2D(m_projectedPositions.at(index));
+        const float deltaX(position2D.GetX() - thisPosition2D.GetX());
+
+        if (deltaX * deltaX > closestDistanceSquared)
+            return false;
+
+        const float thisDistanceSquared((position2D - thisPosition2D).GetMagnitudeSquared());
+
+        if ((thisDistanceSquared < closestDistanceSquared) ||
+            (foundClosestPosition && (thisDistanceSquared == closestDistanceSquared) && (index < closestIndex)))
+        {
+            foundClosestPosition = true;
+            closestDistanceSquared = thisDistanceSquared;
+            closestIndex = index;
+        }
+
+        return true;
+    };
+
+    for (std::vector<unsigned int>::const_iterator iter = startIter; iter != m_xOrderedIndices.end(); ++iter)
+    {
+        if (!considerIndex(*iter))
+            break;
+    }
+
+    for (std::vector<unsigned int>::const_iterator iter = startIter; iter != m_xOrderedIndices.begin();)
+    {
+        if (!considerIndex(*(--iter)))
+            break;
+    }
+
+    return foundClosestPosition;
+}
+
 } // namespace lar_content
@@ -10,6 +10,9 @@
 
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/HitCreationBaseTool.h"
 
+#include <map>
+#include <memory>
+
 namespace lar_content
 {
 
@@ -23,6 +26,39 @@ public:
         const pandora::CaloHitVector &inputTwoDHits, ProtoHitVector &protoHitVector);
 
 private:
+    /**
+     *  @brief  ProjectedParentHits class, holding the positions of the parent 3D hits projected into a single view, ordered in x
+     */
+    class ProjectedParentHits
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pandora the pandora instance
+         *  @param  parentHits3D the vector of 3D hits from the parent particle
+         *  @param  hitType the view into which to project the parent hits
+         */
+        ProjectedParentHits(const pandora::Pandora &pandora, const pandora::CaloHitVector &parentHits3D, const pandora::HitType hitType);
+
+        /**
+         *  @brief  Find the parent hit whose projection is closest to a specified position, choosing the first in parent hit order
+         *          in the event of a tie
+         *
+         *  @param  position2D the position
+         *  @param  closestIndex to receive the index of the closest parent hit
+         *
+         *  @return whether a closest parent hit was found
+         */
+        bool GetClosestParentHit(const pandora::CartesianVector &position2D, unsigned int &closestIndex) const;
+
+    private:
+        pandora::CartesianPointVector m_projectedPositions; ///< The projected positions, in parent hit order
+        std::vector<unsigned int> m_xOrderedIndices;        ///< The indices of the projected positions, sorted by x
+    };
+
+    typedef std::map<pandora::HitType, std::unique_ptr<const ProjectedParentHits>> ProjectedParentHitsMap;
+
     /**
      *  @brief  Create three dimensional hits, using a list of input two dimensional hits and the 3D hits from the parent particle
      *
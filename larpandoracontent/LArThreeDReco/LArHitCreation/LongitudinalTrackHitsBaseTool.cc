@@ -79,21 +79,21 @@ void LongitudinalTrackHitsBaseTool::GetVertexAndEndPositions(const MatchedSlidin
 
         if (foundU)
         {
-            const TwoDSlidingFitResult &slidingFitResultU = iterU->second;
+            const TwoDSlidingFitResult &slidingFitResultU = *(iterU->second);
             vtxU = (isForwardU ? slidingFitResultU.GetGlobalMinLayerPosition() : slidingFitResultU.GetGlobalMaxLayerPosition());
             endU = (isForwardU ? slidingFitResultU.GetGlobalMaxLayerPosition() : slidingFitResultU.GetGlobalMinLayerPosition());
         }
 
         if (foundV)
         {
-            const TwoDSlidingFitResult &slidingFitResultV = iterV->second;
+            const TwoDSlidingFitResult &slidingFitResultV = *(iterV->second);
             vtxV = (isForwardV ? slidingFitResultV.GetGlobalMinLayerPosition() : slidingFitResultV.GetGlobalMaxLayerPosition());
             endV = (isForwardV ? slidingFitResultV.GetGlobalMaxLayerPosition() : slidingFitResultV.GetGlobalMinLayerPosition());
         }
 
         if (foundW)
         {
-            const TwoDSlidingFitResult &slidingFitResultW = iterW->second;
+            const TwoDSlidingFitResult &slidingFitResultW = *(iterW->second);
             vtxW = (isForwardW ? slidingFitResultW.GetGlobalMinLayerPosition() : slidingFitResultW.GetGlobalMaxLayerPosition());
             endW = (isForwardW ? slidingFitResultW.GetGlobalMaxLayerPosition() : slidingFitResultW.GetGlobalMinLayerPosition());
         }
@@ -39,7 +39,7 @@ void MultiValuedLongitudinalTrackHitsTool::GetLongitudinalTrackHit3D(
     MatchedSlidingFitMap::const_iterator fIter1 = matchedSlidingFitMap.find(hitType1);
     if (matchedSlidingFitMap.end() != fIter1)
     {
-        const TwoDSlidingFitResult &fitResult1 = fIter1->second;
+        const TwoDSlidingFitResult &fitResult1 = *(fIter1->second);
         const CartesianVector position2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), projection3D, hitType1));
 
         CartesianVector position1(0.f, 0.f, 0.f);
@@ -55,7 +55,7 @@ void MultiValuedLongitudinalTrackHitsTool::GetLongitudinalTrackHit3D(
     MatchedSlidingFitMap::const_iterator fIter2 = matchedSlidingFitMap.find(hitType2);
     if (matchedSlidingFitMap.end() != fIter2)
     {
-        const TwoDSlidingFitResult &fitResult2 = fIter2->second;
+        const TwoDSlidingFitResult &fitResult2 = *(fIter2->second);
         const CartesianVector position2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), projection3D, hitType2));
 
         CartesianVector position2(0.f, 0.f, 0.f);
@@ -28,7 +28,7 @@ void MultiValuedTransverseTrackHitsTool::GetTransverseTrackHit3D(const MatchedSl
 
     if (matchedSlidingFitMap.end() != iter1)
     {
-        const TwoDSlidingFitResult &fitResult1 = iter1->second;
+        const TwoDSlidingFitResult &fitResult1 = *(iter1->second);
         PANDORA_THROW_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
             fitResult1.GetGlobalFitPositionListAtX(pCaloHit2D->GetPositionVector().GetX(), fitPositionList1));
     }
@@ -37,7 +37,7 @@ void MultiValuedTransverseTrackHitsTool::GetTransverseTrackHit3D(const MatchedSl
 
     if (matchedSlidingFitMap.end() != iter2)
     {
-        const TwoDSlidingFitResult &fitResult2 = iter2->second;
+        const TwoDSlidingFitResult &fitResult2 = *(iter2->second);
         PANDORA_THROW_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
             fitResult2.GetGlobalFitPositionListAtX(pCaloHit2D->GetPositionVector().GetX(), fitPositionList2));
     }
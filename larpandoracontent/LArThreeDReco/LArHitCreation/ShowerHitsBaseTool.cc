@@ -13,6 +13,8 @@
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/ShowerHitsBaseTool.h"
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/ThreeDHitCreationAlgorithm.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -54,13 +56,17 @@ void ShowerHitsBaseTool::Run(ThreeDHitCreationAlgorithm *const pAlgorithm, const
 void ShowerHitsBaseTool::GetShowerHits3D(const CaloHitVector &inputTwoDHits, const CaloHitVector &caloHitVector1,
     const CaloHitVector &caloHitVector2, ProtoHitVector &protoHitVector) const
 {
+    std::vector<unsigned int> xOrderedIndices1, xOrderedIndices2;
+    this->GetXOrderedIndices(caloHitVector1, xOrderedIndices1);
+    this->GetXOrderedIndices(caloHitVector2, xOrderedIndices2);
+
     for (const CaloHit *const pCaloHit2D : inputTwoDHits)
     {
         try
         {
             CaloHitVector filteredHits1, filteredHits2;
-            this->FilterCaloHits(pCaloHit2D->GetPositionVector().GetX(), m_xTolerance, caloHitVector1, filteredHits1);
-            this->FilterCaloHits(pCaloHit2D->GetPositionVector().GetX(), m_xTolerance, caloHitVector2, filteredHits2);
+            this->FilterCaloHits(pCaloHit2D->GetPositionVector().GetX(), m_xTolerance, caloHitVector1, xOrderedIndices1, filteredHits1);
+            this->FilterCaloHits(pCaloHit2D->GetPositionVector().GetX(), m_xTolerance, caloHitVector2, xOrderedIndices2, filteredHits2);
 
             ProtoHit protoHit(pCaloHit2D);
             this->GetShowerHit3D(filteredHits1, filteredHits2, protoHit);
@@ -76,15 +82,35 @@ void ShowerHitsBaseTool::GetShowerHits3D(const CaloHitVector &inputTwoDHits, con
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void ShowerHitsBaseTool::FilterCaloHits(const float x, const float xTolerance, const CaloHitVector &inputCaloHitVector, CaloHitVector &outputCaloHitVector) const
+void ShowerHitsBaseTool::GetXOrderedIndices(const CaloHitVector &caloHitVector, std::vector<unsigned int> &xOrderedIndices) const
 {
-    for (const CaloHit *const pCaloHit : inputCaloHitVector)
-    {
-        const float deltaX(pCaloHit->GetPositionVector().GetX() - x);
+    for (unsigned int index = 0; index < caloHitVector.size(); ++index)
+        xOrderedIndices.push_back(index);
 
-        if (std::fabs(deltaX) < xTolerance)
-            outputCaloHitVector.push_back(pCaloHit);
-    }
+    std::stable_sort(xOrderedIndices.begin(), xOrderedIndices.end(), [&caloHitVector](const unsigned int lhs, const unsigned int rhs) {
+        return (caloHitVector.at(lhs)->GetPositionVector().GetX() < caloHitVector.at(rhs)->GetPositionVector().GetX());
+    });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ShowerHitsBaseTool::FilterCaloHits(const float x, const float xTolerance, const CaloHitVector &inputCaloHitVector,
+    const std::vector<unsigned int> &xOrderedIndices, CaloHitVector &outputCaloHitVector) const
+{
+    // ATTN The hits satisfying std::fabs(deltaX) < xTolerance are contiguous in x order, as deltaX never decreases with hit x position
+    auto deltaX = [&inputCaloHitVector, x](const unsigned int index) { return (inputCaloHitVector.at(index)->GetPositionVector().GetX() - x); };
+
+    const std::vector<unsigned int>::const_iterator beginIter(std::partition_point(
+        xOrderedIndices.begin(), xOrderedIndices.end(), [&deltaX, xTolerance](const unsigned int index) { return (deltaX(index) <= -xTolerance); }));
+    const std::vector<unsigned int>::const_iterator endIter(std::partition_point(
+        beginIter, xOrderedIndices.end(), [&deltaX, xTolerance](const unsigned int index) { return (deltaX(index) < xTolerance); }));
+
+    // Preserve the input order, on which the subsequent choice of three dimensional position can depend
+    std::vector<unsigned int> selectedIndices(beginIter, endIter);
+    std::sort(selectedIndices.begin(), selectedIndices.end());
+
+    for (const unsigned int index : selectedIndices)
+        outputCaloHitVector.push_back(inputCaloHitVector.at(index));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -53,16 +53,25 @@ protected:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
 private:
+    /**
+     *  @brief  Get the indices of the hits in a calo hit vector, sorted by x position
+     *
+     *  @param  caloHitVector the calo hit vector
+     *  @param  xOrderedIndices to receive the indices of the hits, sorted by x position
+     */
+    void GetXOrderedIndices(const pandora::CaloHitVector &caloHitVector, std::vector<unsigned int> &xOrderedIndices) const;
+
     /**
      *  @brief  Filter a list of calo hits to find those within a specified tolerance of a give x position
      *
      *  @param  x the x position
      *  @param  xTolerance the x tolerance
      *  @param  inputCaloHitVector the input calo hit vector
-     *  @param  outputCaloHitVector to receive the output calo hit vector
+     *  @param  xOrderedIndices the indices of the input hits, sorted by x position
+     *  @param  outputCaloHitVector to receive the output calo hit vector, in input order
      */
     void FilterCaloHits(const float x, const float xTolerance, const pandora::CaloHitVector &inputCaloHitVector,
-        pandora::CaloHitVector &outputCaloHitVector) const;
+        const std::vector<unsigned int> &xOrderedIndices, pandora::CaloHitVector &outputCaloHitVector) const;
 
     float m_xTolerance; ///< The x tolerance to use when looking for associated calo hits between views
 };
@@ -12,6 +12,9 @@
 
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/ThreeViewShowerHitsTool.h"
 
+#include <algorithm>
+#include <cmath>
+
 using namespace pandora;
 
 namespace lar_content
@@ -35,13 +38,46 @@ void ThreeViewShowerHitsTool::GetShowerHit3D(const CaloHitVector &caloHitVector1
     const HitType hitType2D(pCaloHit2D->GetHitType());
     const float position2D(pCaloHit2D->GetPositionVector().GetZ());
 
+    std::vector<unsigned int> allIndices2, zOrderedIndices2;
+
+    for (unsigned int index = 0; index < caloHitVector2.size(); ++index)
+        allIndices2.push_back(index);
+
+    zOrderedIndices2 = allIndices2;
+    std::stable_sort(zOrderedIndices2.begin(), zOrderedIndices2.end(), [&caloHitVector2](const unsigned int lhs, const unsigned int rhs) {
+        return (caloHitVector2.at(lhs)->GetPositionVector().GetZ() < caloHitVector2.at(rhs)->GetPositionVector().GetZ());
+    });
+
+    std::vector<unsigned int> candidateIndices2;
+
     for (const CaloHit *const pCaloHit1 : caloHitVector1)
     {
         const CartesianVector &position1(pCaloHit1->GetPositionVector());
         const float prediction(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), hitType2D, hitType1, position2D, position1.GetZ()));
 
-        for (const CaloHit *const pCaloHit2 : caloHitVector2)
+        // ATTN The hits within the z tolerance of the prediction are contiguous in z order, but must be considered in input order
+        auto deltaZ = [&caloHitVector2, prediction](const unsigned int index) {
+            return (caloHitVector2.at(index)->GetPositionVector().GetZ() - prediction);
+        };
+
+        if (std::isnan(prediction))
+        {
+            candidateIndices2 = allIndices2;
+        }
+        else
+        {
+            const std::vector<unsigned int>::const_iterator beginIter(std::partition_point(zOrderedIndices2.begin(), zOrderedIndices2.end(),
+                [&deltaZ, this](const unsigned int index) { return (deltaZ(index) < -m_zTolerance); }));
+            const std::vector<unsigned int>::const_iterator endIter(std::partition_point(
+                beginIter, zOrderedIndices2.end(), [&deltaZ, this](const unsigned int index) { return !(deltaZ(index) > m_zTolerance); }));
+
+            candidateIndices2.assign(beginIter, endIter);
+            std::sort(candidateIndices2.begin(), candidateIndices2.end());
+        }
+
+        for (const unsigned int index2 : candidateIndices2)
         {
+            const CaloHit *const pCaloHit2(caloHitVector2.at(index2));
             const CartesianVector &position2(pCaloHit2->GetPositionVector());
 
             if (std::fabs(position2.GetZ() - prediction) > m_zTolerance)
@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/ThreeDHitCreationAlgorithm.h"
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/TrackHitsBaseTool.h"
@@ -73,9 +74,10 @@ void TrackHitsBaseTool::BuildSlidingFitMap(const ParticleFlowObject *const pPfo,
 
         try
         {
-            const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitWindow, slidingFitPitch);
+            const TwoDSlidingFitResultPtr pSlidingFitResult(
+                LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, m_slidingFitWindow, slidingFitPitch));
 
-            if (!matchedSlidingFitMap.insert(MatchedSlidingFitMap::value_type(hitType, slidingFitResult)).second)
+            if (!matchedSlidingFitMap.insert(MatchedSlidingFitMap::value_type(hitType, pSlidingFitResult)).second)
                 throw StatusCodeException(STATUS_CODE_FAILURE);
         }
         catch (StatusCodeException &statusCodeException)
@@ -88,6 +90,14 @@ void TrackHitsBaseTool::BuildSlidingFitMap(const ParticleFlowObject *const pPfo,
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TrackHitsBaseTool::Reset()
+{
+    LArSlidingFitCacheHelper::Reset(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TrackHitsBaseTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinViews", m_minViews));
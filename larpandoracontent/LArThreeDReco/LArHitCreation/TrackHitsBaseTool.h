@@ -32,7 +32,7 @@ public:
         const pandora::CaloHitVector &inputTwoDHits, ProtoHitVector &protoHitVector);
 
 protected:
-    typedef std::map<pandora::HitType, TwoDSlidingFitResult> MatchedSlidingFitMap;
+    typedef std::map<pandora::HitType, TwoDSlidingFitResultPtr> MatchedSlidingFitMap;
 
     /**
      *  @brief  Calculate 3D hits from an input list of 2D hits
@@ -53,6 +53,7 @@ protected:
      */
     virtual void BuildSlidingFitMap(const pandora::ParticleFlowObject *const pPfo, MatchedSlidingFitMap &matchedSlidingFitMap) const;
 
+    virtual pandora::StatusCode Reset();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     unsigned int m_minViews;         ///< The minimum number of views required for building hits
@@ -53,7 +53,7 @@ void TransverseTrackHitsBaseTool::AddTransverseChi2(const MatchedSlidingFitMap &
             continue;
 
         const CartesianVector inputPosition2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), inputPosition3D, mapEntry.first));
-        chiSquared += this->GetTransverseChi2(inputPosition2D, mapEntry.second);
+        chiSquared += this->GetTransverseChi2(inputPosition2D, *(mapEntry.second));
     }
 
     protoHit.SetPosition3D(inputPosition3D, chiSquared);
@@ -28,6 +28,13 @@ ThreeViewLongitudinalTracksAlgorithm::ThreeViewLongitudinalTracksAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool ThreeViewLongitudinalTracksAlgorithm::IsOverlapCalculationThreadSafe() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeViewLongitudinalTracksAlgorithm::CalculateOverlapResult(
     const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
 {
@@ -35,7 +42,7 @@ void ThreeViewLongitudinalTracksAlgorithm::CalculateOverlapResult(
     this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
 
     if (overlapResult.IsInitialized())
-        this->GetMatchingControl().GetOverlapTensor().SetOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
+        this->GetMatchingControl().SetOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -38,6 +38,7 @@ public:
 
 private:
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
+    bool IsOverlapCalculationThreadSafe() const;
 
     /**
      *  @brief  Calculate the overlap result for given group of clusters
@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 
@@ -41,6 +42,14 @@ ParticleRecoveryAlgorithm::ParticleRecoveryAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode ParticleRecoveryAlgorithm::Reset()
+{
+    LArSlidingFitCacheHelper::Reset(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ParticleRecoveryAlgorithm::Run()
 {
     ClusterList inputClusterListU, inputClusterListV, inputClusterListW;
@@ -264,7 +273,9 @@ void ParticleRecoveryAlgorithm::CalculateEffectiveSpan(
     {
         const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
-        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitHalfWindow, slidingFitPitch);
+        const TwoDSlidingFitResultPtr pSlidingFitResult(
+            LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, m_slidingFitHalfWindow, slidingFitPitch));
+        const TwoDSlidingFitResult &slidingFitResult(*pSlidingFitResult);
 
         const int nSamplingPointsLeft(1 + static_cast<int>((xMinEff - xMin) / m_sampleStepSize));
         const int nSamplingPointsRight(1 + static_cast<int>((xMax - xMaxEff) / m_sampleStepSize));
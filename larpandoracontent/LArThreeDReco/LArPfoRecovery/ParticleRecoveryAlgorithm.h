@@ -69,6 +69,7 @@ private:
         ClusterNavigationMap m_clusterNavigationMapWU; ///< The cluster navigation map W->U
     };
 
+    pandora::StatusCode Reset();
     pandora::StatusCode Run();
 
     /**
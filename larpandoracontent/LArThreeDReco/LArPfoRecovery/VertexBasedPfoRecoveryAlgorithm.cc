@@ -13,6 +13,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 using namespace pandora;
 
@@ -30,6 +31,14 @@ VertexBasedPfoRecoveryAlgorithm::VertexBasedPfoRecoveryAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode VertexBasedPfoRecoveryAlgorithm::Reset()
+{
+    LArSlidingFitCacheHelper::Reset(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode VertexBasedPfoRecoveryAlgorithm::Run()
 {
     const VertexList *pVertexList = NULL;
@@ -51,7 +60,7 @@ StatusCode VertexBasedPfoRecoveryAlgorithm::Run()
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetAvailableClusters(m_inputClusterListNames, availableClusters));
 
     // Build a set of sliding fit results
-    TwoDSlidingFitResultMap slidingFitResultMap;
+    TwoDSlidingFitResultPtrMap slidingFitResultMap;
     this->BuildSlidingFitResultMap(availableClusters, slidingFitResultMap);
 
     // Select seed clusters (adjacent to vertex)
@@ -109,7 +118,8 @@ StatusCode VertexBasedPfoRecoveryAlgorithm::GetAvailableClusters(const StringVec
 }
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void VertexBasedPfoRecoveryAlgorithm::BuildSlidingFitResultMap(const ClusterVector &clusterVector, TwoDSlidingFitResultMap &slidingFitResultMap) const
+void VertexBasedPfoRecoveryAlgorithm::BuildSlidingFitResultMap(
+    const ClusterVector &clusterVector, TwoDSlidingFitResultPtrMap &slidingFitResultMap) const
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
@@ -119,13 +129,14 @@ void VertexBasedPfoRecoveryAlgorithm::BuildSlidingFitResultMap(const ClusterVect
         {
             try
             {
-                const TwoDSlidingFitResult slidingFitResult(*iter, m_slidingFitHalfWindow, slidingFitPitch);
-                const LArPointingCluster pointingCluster(slidingFitResult);
+                const TwoDSlidingFitResultPtr pSlidingFitResult(
+                    LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), *iter, m_slidingFitHalfWindow, slidingFitPitch));
+                const LArPointingCluster pointingCluster(*pSlidingFitResult);
 
                 if (pointingCluster.GetLengthSquared() < std::numeric_limits<float>::epsilon())
                     continue;
 
-                if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, slidingFitResult)).second)
+                if (!slidingFitResultMap.insert(TwoDSlidingFitResultPtrMap::value_type(*iter, pSlidingFitResult)).second)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
             }
             catch (StatusCodeException &statusCodeException)
@@ -139,7 +150,7 @@ void VertexBasedPfoRecoveryAlgorithm::BuildSlidingFitResultMap(const ClusterVect
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void VertexBasedPfoRecoveryAlgorithm::SelectVertexClusters(const Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+void VertexBasedPfoRecoveryAlgorithm::SelectVertexClusters(const Vertex *const pVertex, const TwoDSlidingFitResultPtrMap &slidingFitResultMap,
     const ClusterVector &inputClusters, ClusterVector &outputClusters) const
 {
     const CartesianVector vertexU(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), TPC_VIEW_U));
@@ -156,11 +167,11 @@ void VertexBasedPfoRecoveryAlgorithm::SelectVertexClusters(const Vertex *const p
 
         const CartesianVector vertexPosition((TPC_VIEW_U == hitType) ? vertexU : (TPC_VIEW_V == hitType) ? vertexV : vertexW);
 
-        TwoDSlidingFitResultMap::const_iterator sIter = slidingFitResultMap.find(pCluster);
+        TwoDSlidingFitResultPtrMap::const_iterator sIter = slidingFitResultMap.find(pCluster);
         if (slidingFitResultMap.end() == sIter)
             continue;
 
-        const TwoDSlidingFitResult &slidingFitResult = sIter->second;
+        const TwoDSlidingFitResult &slidingFitResult = *(sIter->second);
         const LArPointingCluster pointingCluster(slidingFitResult);
 
         for (unsigned int iVtx = 0; iVtx < 2; ++iVtx)
@@ -181,7 +192,7 @@ void VertexBasedPfoRecoveryAlgorithm::SelectVertexClusters(const Vertex *const p
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void VertexBasedPfoRecoveryAlgorithm::MatchThreeViews(const Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+void VertexBasedPfoRecoveryAlgorithm::MatchThreeViews(const Vertex *const pVertex, const TwoDSlidingFitResultPtrMap &slidingFitResultMap,
     const ClusterVector &inputClusters, ClusterSet &vetoList, ParticleList &particleList) const
 {
     while (true)
@@ -223,7 +234,7 @@ void VertexBasedPfoRecoveryAlgorithm::MatchThreeViews(const Vertex *const pVerte
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void VertexBasedPfoRecoveryAlgorithm::MatchTwoViews(const Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+void VertexBasedPfoRecoveryAlgorithm::MatchTwoViews(const Vertex *const pVertex, const TwoDSlidingFitResultPtrMap &slidingFitResultMap,
     const ClusterVector &inputClusters, ClusterSet &vetoList, ParticleList &particleList) const
 {
     while (true)
@@ -261,7 +272,7 @@ void VertexBasedPfoRecoveryAlgorithm::MatchTwoViews(const Vertex *const pVertex,
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const Vertex *const pVertex, const TwoDSlidingFitResultPtrMap &slidingFitResultMap,
     const ClusterVector &clusters1, const ClusterVector &clusters2, const ClusterVector &clusters3, const Cluster *&pBestCluster1,
     const Cluster *&pBestCluster2, const Cluster *&pBestCluster3, float &bestChi2) const
 {
@@ -273,11 +284,11 @@ void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const Vertex *const pVertex, c
     {
         const Cluster *const pCluster1 = *cIter1;
 
-        TwoDSlidingFitResultMap::const_iterator sIter1 = slidingFitResultMap.find(pCluster1);
+        TwoDSlidingFitResultPtrMap::const_iterator sIter1 = slidingFitResultMap.find(pCluster1);
         if (slidingFitResultMap.end() == sIter1)
             continue;
 
-        const TwoDSlidingFitResult &slidingFitResult1 = sIter1->second;
+        const TwoDSlidingFitResult &slidingFitResult1 = *(sIter1->second);
         const LArPointingCluster pointingCluster1(slidingFitResult1);
 
         // Second loop
@@ -285,11 +296,11 @@ void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const Vertex *const pVertex, c
         {
             const Cluster *const pCluster2 = *cIter2;
 
-            TwoDSlidingFitResultMap::const_iterator sIter2 = slidingFitResultMap.find(pCluster2);
+            TwoDSlidingFitResultPtrMap::const_iterator sIter2 = slidingFitResultMap.find(pCluster2);
             if (slidingFitResultMap.end() == sIter2)
                 continue;
 
-            const TwoDSlidingFitResult &slidingFitResult2 = sIter2->second;
+            const TwoDSlidingFitResult &slidingFitResult2 = *(sIter2->second);
             const LArPointingCluster pointingCluster2(slidingFitResult2);
 
             // Third loop
@@ -297,11 +308,11 @@ void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const Vertex *const pVertex, c
             {
                 const Cluster *const pCluster3 = *cIter3;
 
-                TwoDSlidingFitResultMap::const_iterator sIter3 = slidingFitResultMap.find(pCluster3);
+                TwoDSlidingFitResultPtrMap::const_iterator sIter3 = slidingFitResultMap.find(pCluster3);
                 if (slidingFitResultMap.end() == sIter3)
                     continue;
 
-                const TwoDSlidingFitResult &slidingFitResult3 = sIter3->second;
+                const TwoDSlidingFitResult &slidingFitResult3 = *(sIter3->second);
                 const LArPointingCluster pointingCluster3(slidingFitResult3);
 
                 // Calculate chi-squared
@@ -321,7 +332,7 @@ void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const Vertex *const pVertex, c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const Vertex *const pVertex, const TwoDSlidingFitResultPtrMap &slidingFitResultMap,
     const ClusterVector &clusters1, const ClusterVector &clusters2, const Cluster *&pBestCluster1, const Cluster *&pBestCluster2, float &bestChi2) const
 {
     if (clusters1.empty() || clusters2.empty())
@@ -332,11 +343,11 @@ void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const Vertex *const pVertex, c
     {
         const Cluster *const pCluster1 = *cIter1;
 
-        TwoDSlidingFitResultMap::const_iterator sIter1 = slidingFitResultMap.find(pCluster1);
+        TwoDSlidingFitResultPtrMap::const_iterator sIter1 = slidingFitResultMap.find(pCluster1);
         if (slidingFitResultMap.end() == sIter1)
             continue;
 
-        const TwoDSlidingFitResult &slidingFitResult1 = sIter1->second;
+        const TwoDSlidingFitResult &slidingFitResult1 = *(sIter1->second);
         const LArPointingCluster pointingCluster1(slidingFitResult1);
 
         // Second loop
@@ -344,11 +355,11 @@ void VertexBasedPfoRecoveryAlgorithm::GetBestChi2(const Vertex *const pVertex, c
         {
             const Cluster *const pCluster2 = *cIter2;
 
-            TwoDSlidingFitResultMap::const_iterator sIter2 = slidingFitResultMap.find(pCluster2);
+            TwoDSlidingFitResultPtrMap::const_iterator sIter2 = slidingFitResultMap.find(pCluster2);
             if (slidingFitResultMap.end() == sIter2)
                 continue;
 
-            const TwoDSlidingFitResult &slidingFitResult2 = sIter2->second;
+            const TwoDSlidingFitResult &slidingFitResult2 = *(sIter2->second);
             const LArPointingCluster pointingCluster2(slidingFitResult2);
 
             // Calculate chi-squared
@@ -28,6 +28,7 @@ public:
     VertexBasedPfoRecoveryAlgorithm();
 
 private:
+    pandora::StatusCode Reset();
     pandora::StatusCode Run();
 
     /**
@@ -67,7 +68,7 @@ private:
      *  @param  halfWindowLayers the half-window to use for the sliding fits
      *  @param  slidingFitResultMap the sliding fit result map
      */
-    void BuildSlidingFitResultMap(const pandora::ClusterVector &clusterVector, TwoDSlidingFitResultMap &slidingFitResultMap) const;
+    void BuildSlidingFitResultMap(const pandora::ClusterVector &clusterVector, TwoDSlidingFitResultPtrMap &slidingFitResultMap) const;
 
     /**
      *  @brief  Select clusters in proximity to reconstructed vertex
@@ -77,7 +78,7 @@ private:
      *  @param  inputClusters  the input vector of clusters
      *  @param  outputClusters  the output vector of clusters
      */
-    void SelectVertexClusters(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+    void SelectVertexClusters(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultPtrMap &slidingFitResultMap,
         const pandora::ClusterVector &inputClusters, pandora::ClusterVector &outputClusters) const;
 
     /**
@@ -89,7 +90,7 @@ private:
      *  @param  vetoList  the list of matched clusters
      *  @param  particleList the output list of matched clusters
      */
-    void MatchThreeViews(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+    void MatchThreeViews(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultPtrMap &slidingFitResultMap,
         const pandora::ClusterVector &selectedClusters, pandora::ClusterSet &vetoList, ParticleList &particleList) const;
 
     /**
@@ -101,7 +102,7 @@ private:
      *  @param  vetoList  the list of matched clusters
      *  @param  particleList  the output list of matched clusters
      */
-    void MatchTwoViews(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+    void MatchTwoViews(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultPtrMap &slidingFitResultMap,
         const pandora::ClusterVector &selectedClusters, pandora::ClusterSet &vetoList, ParticleList &particleList) const;
 
     /**
@@ -117,7 +118,7 @@ private:
      *  @param  pBestCluster3  the best-matched cluster from the third view
      *  @param  chi2  the chi-squared metric from the best match
      */
-    void GetBestChi2(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap,
+    void GetBestChi2(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultPtrMap &slidingFitResultMap,
         const pandora::ClusterVector &clusters1, const pandora::ClusterVector &clusters2, const pandora::ClusterVector &clusters3,
         const pandora::Cluster *&pBestCluster1, const pandora::Cluster *&pBestCluster2, const pandora::Cluster *&pBestCluster3, float &chi2) const;
 
@@ -132,8 +133,9 @@ private:
      *  @param  pBestCluster2 the best-matched cluster from the second view
      *  @param  chi2 the chi-squared metric from the best match
      */
-    void GetBestChi2(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultMap &slidingFitResultMap, const pandora::ClusterVector &clusters1,
-        const pandora::ClusterVector &clusters2, const pandora::Cluster *&pBestCluster1, const pandora::Cluster *&pBestCluster2, float &chi2) const;
+    void GetBestChi2(const pandora::Vertex *const pVertex, const TwoDSlidingFitResultPtrMap &slidingFitResultMap,
+        const pandora::ClusterVector &clusters1, const pandora::ClusterVector &clusters2, const pandora::Cluster *&pBestCluster1,
+        const pandora::Cluster *&pBestCluster2, float &chi2) const;
 
     /**
      *  @brief  Merge two pointing clusters and return chi-squared metric giving consistency of matching
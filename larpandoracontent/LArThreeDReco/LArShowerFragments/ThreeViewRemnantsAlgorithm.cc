@@ -46,6 +46,13 @@ void ThreeViewRemnantsAlgorithm::SelectInputClusters(const ClusterList *const pI
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool ThreeViewRemnantsAlgorithm::IsOverlapCalculationThreadSafe() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeViewRemnantsAlgorithm::CalculateOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
 {
     // Requirements on X matching
@@ -83,7 +90,7 @@ void ThreeViewRemnantsAlgorithm::CalculateOverlapResult(const Cluster *const pCl
     // ATTN Essentially a boolean result; actual value matters only so as to ensure that overlap results can be sorted
     const float hackValue(
         pseudoChi2 + pClusterU->GetElectromagneticEnergy() + pClusterV->GetElectromagneticEnergy() + pClusterW->GetElectromagneticEnergy());
-    this->GetMatchingControl().GetOverlapTensor().SetOverlapResult(pClusterU, pClusterV, pClusterW, hackValue);
+    this->GetMatchingControl().SetOverlapResult(pClusterU, pClusterV, pClusterW, hackValue);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
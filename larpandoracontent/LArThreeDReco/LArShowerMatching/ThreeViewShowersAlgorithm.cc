@@ -143,6 +143,13 @@ void ThreeViewShowersAlgorithm::RemoveFromSlidingFitCache(const Cluster *const p
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool ThreeViewShowersAlgorithm::IsOverlapCalculationThreadSafe() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeViewShowersAlgorithm::CalculateOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW)
 {
     ShowerOverlapResult overlapResult;
@@ -150,7 +157,7 @@ void ThreeViewShowersAlgorithm::CalculateOverlapResult(const Cluster *const pClu
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult));
 
     if (overlapResult.IsInitialized())
-        this->GetMatchingControl().GetOverlapTensor().SetOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
+        this->GetMatchingControl().SetOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
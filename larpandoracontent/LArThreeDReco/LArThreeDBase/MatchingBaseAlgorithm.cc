@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/MatchingBaseAlgorithm.h"
 
@@ -29,6 +30,13 @@ MatchingBaseAlgorithm::~MatchingBaseAlgorithm()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool MatchingBaseAlgorithm::IsOverlapCalculationThreadSafe() const
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void MatchingBaseAlgorithm::SelectInputClusters(const ClusterList *const pInputClusterList, ClusterList &selectedClusterList) const
 {
     if (!pInputClusterList)
@@ -72,6 +80,8 @@ bool MatchingBaseAlgorithm::MakeClusterMerges(const ClusterMergeMap &clusterMerg
 
             this->UpdateUponDeletion(pDaughterCluster);
             this->UpdateUponDeletion(pParentCluster);
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pParentCluster);
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pDaughterCluster);
             PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
                 PandoraContentApi::MergeAndDeleteClusters(*this, pParentCluster, pDaughterCluster, clusterListName, clusterListName));
 
@@ -99,6 +99,14 @@ public:
     virtual void CalculateOverlapResult(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2,
         const pandora::Cluster *const pCluster3 = nullptr) = 0;
 
+    /**
+     *  @brief  Whether CalculateOverlapResult may be called concurrently by the matching control main loop, i.e. whether it reads only
+     *          state prepared before the main loop and reports results only via the matching control. Required for NMainLoopThreads > 1.
+     *
+     *  @return boolean
+     */
+    virtual bool IsOverlapCalculationThreadSafe() const;
+
     /**
      *  @brief  Select a subset of input clusters for processing in this algorithm
      *
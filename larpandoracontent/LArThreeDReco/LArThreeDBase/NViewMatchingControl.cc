@@ -0,0 +1,118 @@
+/**
+ *  @file   larpandoracontent/LArThreeDReco/LArThreeDBase/NViewMatchingControl.cc
+ *
+ *  @brief  Implementation of the n view matching control class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "larpandoracontent/LArThreeDReco/LArThreeDBase/MatchingBaseAlgorithm.h"
+#include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewMatchingControl.h"
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+NViewMatchingControl::XOverlapIndex::XOverlapIndex(const ClusterVector &clusterVector, const XSpanMap &xSpanMap) :
+    m_clusterVector(clusterVector),
+    m_maxXSpan(0.f)
+{
+    for (unsigned int index = 0; index < m_clusterVector.size(); ++index)
+    {
+        const XSpan &xSpan(xSpanMap.at(m_clusterVector.at(index)));
+        m_entryVector.push_back({xSpan.first, xSpan.second, index});
+        m_maxXSpan = std::max(m_maxXSpan, xSpan.second - xSpan.first);
+    }
+
+    std::sort(m_entryVector.begin(), m_entryVector.end(), [](const Entry &lhs, const Entry &rhs) {
+        return ((lhs.m_xMin < rhs.m_xMin) || ((lhs.m_xMin == rhs.m_xMin) && (lhs.m_index < rhs.m_index)));
+    });
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void NViewMatchingControl::XOverlapIndex::GetCandidates(const XSpan &xSpan, const float minXOverlap, ClusterVector &candidates) const
+{
+    candidates.clear();
+
+    if ((xSpan.second - xSpan.first) <= minXOverlap)
+        return;
+
+    // ATTN Overlap requires xMin < xSpan.second - minXOverlap and xMax > xSpan.first + minXOverlap, with xMax <= xMin + m_maxXSpan.
+    // The search window in xMin is widened by a small margin, to protect against rounding, with the exact requirements applied below.
+    const float searchMargin(1.f);
+    const float xMinLow(xSpan.first + minXOverlap - m_maxXSpan - searchMargin);
+    const float xMinHigh(xSpan.second - minXOverlap + searchMargin);
+
+    EntryVector::const_iterator beginIter(std::lower_bound(
+        m_entryVector.begin(), m_entryVector.end(), xMinLow, [](const Entry &entry, const float value) { return (entry.m_xMin < value); }));
+    EntryVector::const_iterator endIter(std::upper_bound(
+        beginIter, m_entryVector.end(), xMinHigh, [](const float value, const Entry &entry) { return (value < entry.m_xMin); }));
+
+    std::vector<unsigned int> candidateIndices;
+
+    for (EntryVector::const_iterator iter = beginIter; iter != endIter; ++iter)
+    {
+        const float xOverlap(std::min(iter->m_xMax, xSpan.second) - std::max(iter->m_xMin, xSpan.first));
+
+        if (xOverlap > minXOverlap)
+            candidateIndices.push_back(iter->m_index);
+    }
+
+    std::sort(candidateIndices.begin(), candidateIndices.end());
+
+    for (const unsigned int index : candidateIndices)
+        candidates.push_back(m_clusterVector.at(index));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const NViewMatchingControl::XSpan &NViewMatchingControl::GetXSpan(const Cluster *const pCluster)
+{
+    XSpanMap::const_iterator iter(m_xSpanMap.find(pCluster));
+
+    if (m_xSpanMap.end() != iter)
+        return iter->second;
+
+    float xMin(0.f), xMax(0.f);
+    pCluster->GetClusterSpanX(xMin, xMax);
+
+    return m_xSpanMap.emplace(pCluster, XSpan(xMin, xMax)).first->second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void NViewMatchingControl::CacheXSpans(const ClusterVector &clusterVector)
+{
+    for (const Cluster *const pCluster : clusterVector)
+        this->GetXSpan(pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode NViewMatchingControl::ReadMainLoopSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseXOverlapPreFilter", m_useXOverlapPreFilter));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "PreFilterMinXOverlap", m_minCandidateXOverlap));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NMainLoopThreads", m_nMainLoopThreads));
+
+    if ((m_nMainLoopThreads > 1) && !m_pAlgorithm->IsOverlapCalculationThreadSafe())
+    {
+        std::cout << m_pAlgorithm->GetType() << ": NMainLoopThreads must be 1, as the overlap calculation is not thread safe (provided: "
+                  << m_nMainLoopThreads << ")" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace lar_content
@@ -8,6 +8,12 @@
 #ifndef LAR_N_VIEW_MATCHING_CONTROL_H
 #define LAR_N_VIEW_MATCHING_CONTROL_H 1
 
+#include "Pandora/PandoraInternal.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
 namespace lar_content
 {
 
@@ -34,6 +40,94 @@ public:
     virtual ~NViewMatchingControl();
 
 protected:
+    typedef std::pair<float, float> XSpan; ///< The minimum and maximum x coordinates spanned by a cluster
+    typedef std::unordered_map<const pandora::Cluster *, XSpan> XSpanMap;
+
+    /**
+     *  @brief  XOverlapIndex class, identifying the clusters whose x-spans overlap a specified x interval without examining all clusters
+     */
+    class XOverlapIndex
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  clusterVector the vector of clusters to index
+         *  @param  xSpanMap the x span map, which must contain entries for all of the clusters to index
+         */
+        XOverlapIndex(const pandora::ClusterVector &clusterVector, const XSpanMap &xSpanMap);
+
+        /**
+         *  @brief  Get the indexed clusters whose x-span overlaps a specified x interval by more than a specified amount
+         *
+         *  @param  xSpan the x interval
+         *  @param  minXOverlap the minimum x overlap (a negative value allows for gaps between the cluster and the interval)
+         *  @param  candidates to receive the candidate clusters, provided in the same order as the indexed cluster vector
+         */
+        void GetCandidates(const XSpan &xSpan, const float minXOverlap, pandora::ClusterVector &candidates) const;
+
+    private:
+        /**
+         *  @brief  Entry class
+         */
+        class Entry
+        {
+        public:
+            float m_xMin;         ///< The minimum x coordinate of the cluster
+            float m_xMax;         ///< The maximum x coordinate of the cluster
+            unsigned int m_index; ///< The index of the cluster in the indexed cluster vector
+        };
+
+        typedef std::vector<Entry> EntryVector;
+
+        pandora::ClusterVector m_clusterVector; ///< The indexed cluster vector
+        EntryVector m_entryVector;              ///< The index entries, sorted by minimum x coordinate
+        float m_maxXSpan;                       ///< The largest x-span of any indexed cluster
+    };
+
+    /**
+     *  @brief  Get the x-span of a cluster, using the cached value if available
+     *
+     *  @param  pCluster address of the cluster
+     *
+     *  @return the x-span
+     */
+    const XSpan &GetXSpan(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Ensure the x-spans of all clusters in a provided vector are cached
+     *
+     *  @param  clusterVector the cluster vector
+     */
+    void CacheXSpans(const pandora::ClusterVector &clusterVector);
+
+    /**
+     *  @brief  Get the x interval common to two x-spans (inverted, i.e. min > max, if the spans do not overlap)
+     *
+     *  @param  xSpan1 the first x-span
+     *  @param  xSpan2 the second x-span
+     *
+     *  @return the common x interval
+     */
+    static XSpan GetCommonXSpan(const XSpan &xSpan1, const XSpan &xSpan2);
+
+    /**
+     *  @brief  Whether two x-spans overlap by more than the configured minimum candidate x overlap
+     *
+     *  @param  xSpan1 the first x-span
+     *  @param  xSpan2 the second x-span
+     *
+     *  @return boolean
+     */
+    bool IsXOverlapCandidate(const XSpan &xSpan1, const XSpan &xSpan2) const;
+
+    /**
+     *  @brief  Read the main loop settings (x overlap pre-filter and concurrency) from xml
+     *
+     *  @param  xmlHandle the xml handle
+     */
+    pandora::StatusCode ReadMainLoopSettings(const pandora::TiXmlHandle xmlHandle);
+
     /**
      *  @brief  Update to reflect addition of a new cluster to the problem space
      *
@@ -103,11 +197,20 @@ protected:
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle) = 0;
 
     MatchingBaseAlgorithm *m_pAlgorithm; ///< The address of the matching base algorithm
+
+    bool m_useXOverlapPreFilter;     ///< Whether to only calculate overlap results for cluster combinations with overlapping x-spans
+    float m_minCandidateXOverlap;    ///< The minimum x overlap required for a cluster combination to be considered, if pre-filtering
+    XSpanMap m_xSpanMap;             ///< The cache of cluster x-spans, used for pre-filtering
+    unsigned int m_nMainLoopThreads; ///< The number of main loop threads, above one only if the overlap calculation is thread safe
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline NViewMatchingControl::NViewMatchingControl(MatchingBaseAlgorithm *const pAlgorithm) : m_pAlgorithm(pAlgorithm)
+inline NViewMatchingControl::NViewMatchingControl(MatchingBaseAlgorithm *const pAlgorithm) :
+    m_pAlgorithm(pAlgorithm),
+    m_useXOverlapPreFilter(false),
+    m_minCandidateXOverlap(0.f),
+    m_nMainLoopThreads(1)
 {
 }
 
@@ -117,6 +220,21 @@ inline NViewMatchingControl::~NViewMatchingControl()
 {
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline NViewMatchingControl::XSpan NViewMatchingControl::GetCommonXSpan(const XSpan &xSpan1, const XSpan &xSpan2)
+{
+    return XSpan(std::max(xSpan1.first, xSpan2.first), std::min(xSpan1.second, xSpan2.second));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool NViewMatchingControl::IsXOverlapCandidate(const XSpan &xSpan1, const XSpan &xSpan2) const
+{
+    const XSpan commonXSpan(NViewMatchingControl::GetCommonXSpan(xSpan1, xSpan2));
+    return ((commonXSpan.second - commonXSpan.first) > m_minCandidateXOverlap);
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_N_VIEW_MATCHING_CONTROL_H
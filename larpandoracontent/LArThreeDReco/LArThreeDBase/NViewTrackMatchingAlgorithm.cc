@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 #include "larpandoracontent/LArObjects/LArTrackOverlapResult.h"
@@ -44,12 +45,12 @@ NViewTrackMatchingAlgorithm<T>::~NViewTrackMatchingAlgorithm()
 template <typename T>
 const TwoDSlidingFitResult &NViewTrackMatchingAlgorithm<T>::GetCachedSlidingFitResult(const Cluster *const pCluster) const
 {
-    TwoDSlidingFitResultMap::const_iterator iter = m_slidingFitResultMap.find(pCluster);
+    TwoDSlidingFitResultPtrMap::const_iterator iter = m_slidingFitResultMap.find(pCluster);
 
     if (m_slidingFitResultMap.end() == iter)
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    return iter->second;
+    return *(iter->second);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -158,6 +159,7 @@ bool NViewTrackMatchingAlgorithm<T>::MakeClusterSplit(
         return false;
     }
 
+    LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pCurrentCluster);
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndFragmentation(*this, fragmentListName, originalListName));
     return true;
 }
@@ -255,9 +257,10 @@ template <typename T>
 void NViewTrackMatchingAlgorithm<T>::AddToSlidingFitCache(const Cluster *const pCluster)
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-    const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitWindow, slidingFitPitch);
+    const TwoDSlidingFitResultPtr pSlidingFitResult(
+        LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, m_slidingFitWindow, slidingFitPitch));
 
-    if (!m_slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult)).second)
+    if (!m_slidingFitResultMap.insert(TwoDSlidingFitResultPtrMap::value_type(pCluster, pSlidingFitResult)).second)
         throw StatusCodeException(STATUS_CODE_FAILURE);
 }
 
@@ -266,7 +269,7 @@ void NViewTrackMatchingAlgorithm<T>::AddToSlidingFitCache(const Cluster *const p
 template <typename T>
 void NViewTrackMatchingAlgorithm<T>::RemoveFromSlidingFitCache(const Cluster *const pCluster)
 {
-    TwoDSlidingFitResultMap::iterator iter = m_slidingFitResultMap.find(pCluster);
+    TwoDSlidingFitResultPtrMap::iterator iter = m_slidingFitResultMap.find(pCluster);
 
     if (m_slidingFitResultMap.end() != iter)
         m_slidingFitResultMap.erase(iter);
@@ -283,6 +286,15 @@ void NViewTrackMatchingAlgorithm<T>::TidyUp()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+StatusCode NViewTrackMatchingAlgorithm<T>::Reset()
+{
+    LArSlidingFitCacheHelper::Reset(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 StatusCode NViewTrackMatchingAlgorithm<T>::ReadSettings(const TiXmlHandle xmlHandle)
 {
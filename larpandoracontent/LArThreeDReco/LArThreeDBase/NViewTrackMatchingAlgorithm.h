@@ -102,11 +102,12 @@ protected:
     void RemoveFromSlidingFitCache(const pandora::Cluster *const pCluster);
 
     virtual void TidyUp();
+    virtual pandora::StatusCode Reset();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
 private:
-    unsigned int m_slidingFitWindow;               ///< The layer window for the sliding linear fits
-    TwoDSlidingFitResultMap m_slidingFitResultMap; ///< The sliding fit result map
+    unsigned int m_slidingFitWindow;                  ///< The layer window for the sliding linear fits
+    TwoDSlidingFitResultPtrMap m_slidingFitResultMap; ///< The sliding fit result map
 
     unsigned int m_minClusterCaloHits; ///< The min number of hits in base cluster selection method
     float m_minClusterLengthSquared;   ///< The min length (squared) in base cluster selection method
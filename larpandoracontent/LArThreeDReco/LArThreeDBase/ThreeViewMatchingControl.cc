@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadHelper.h"
 
 #include "larpandoracontent/LArObjects/LArShowerOverlapResult.h"
 #include "larpandoracontent/LArObjects/LArTrackOverlapResult.h"
@@ -16,6 +17,9 @@
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/MatchingBaseAlgorithm.h"
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/ThreeViewMatchingControl.h"
 
+#include <exception>
+#include <memory>
+
 using namespace pandora;
 
 namespace lar_content
@@ -47,6 +51,21 @@ typename ThreeViewMatchingControl<T>::TensorType &ThreeViewMatchingControl<T>::G
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void ThreeViewMatchingControl<T>::SetOverlapResult(
+    const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW, const T &overlapResult)
+{
+    if (m_pOverlapResultBuffer)
+    {
+        m_pOverlapResultBuffer->push_back({pClusterU, pClusterV, pClusterW, overlapResult});
+        return;
+    }
+
+    m_overlapTensor.SetOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void ThreeViewMatchingControl<T>::UpdateForNewCluster(const Cluster *const pNewCluster)
 {
@@ -70,9 +89,31 @@ void ThreeViewMatchingControl<T>::UpdateForNewCluster(const Cluster *const pNewC
     std::sort(clusterVector2.begin(), clusterVector2.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVector3.begin(), clusterVector3.end(), LArClusterHelper::SortByNHits);
 
+    if (m_useXOverlapPreFilter)
+    {
+        // ATTN Any previously cached x-span for this address is stale
+        m_xSpanMap.erase(pNewCluster);
+        this->CacheXSpans(clusterVector2);
+        this->CacheXSpans(clusterVector3);
+    }
+
+    const XSpan newXSpan(m_useXOverlapPreFilter ? this->GetXSpan(pNewCluster) : XSpan(0.f, 0.f));
+    const XOverlapIndex xOverlapIndex3(m_useXOverlapPreFilter ? clusterVector3 : ClusterVector(), m_xSpanMap);
+    ClusterVector candidateVector3;
+
     for (const Cluster *const pCluster2 : clusterVector2)
     {
-        for (const Cluster *const pCluster3 : clusterVector3)
+        if (m_useXOverlapPreFilter)
+        {
+            const XSpan &xSpan2(this->GetXSpan(pCluster2));
+
+            if (!this->IsXOverlapCandidate(newXSpan, xSpan2))
+                continue;
+
+            xOverlapIndex3.GetCandidates(NViewMatchingControl::GetCommonXSpan(newXSpan, xSpan2), m_minCandidateXOverlap, candidateVector3);
+        }
+
+        for (const Cluster *const pCluster3 : (m_useXOverlapPreFilter ? candidateVector3 : clusterVector3))
         {
             if (TPC_VIEW_U == hitType)
             {
@@ -108,6 +149,7 @@ void ThreeViewMatchingControl<T>::UpdateUponDeletion(const Cluster *const pDelet
     if (m_clusterListW.end() != iterW)
         m_clusterListW.erase(iterW);
 
+    m_xSpanMap.erase(pDeletedCluster);
     m_overlapTensor.RemoveCluster(pDeletedCluster);
 }
 
@@ -211,6 +253,8 @@ void ThreeViewMatchingControl<T>::TidyUp()
     m_clusterListU.clear();
     m_clusterListV.clear();
     m_clusterListW.clear();
+
+    m_xSpanMap.clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -225,13 +269,90 @@ void ThreeViewMatchingControl<T>::PerformMainLoop()
     std::sort(clusterVectorV.begin(), clusterVectorV.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVectorW.begin(), clusterVectorW.end(), LArClusterHelper::SortByNHits);
 
-    for (const Cluster *const pClusterU : clusterVectorU)
+    std::unique_ptr<XOverlapIndex> pXOverlapIndexV, pXOverlapIndexW;
+
+    if (m_useXOverlapPreFilter)
+    {
+        // ATTN All x-spans are cached up front, so that the cache is only read within the (possibly concurrent) loop below
+        m_xSpanMap.clear();
+        this->CacheXSpans(clusterVectorU);
+        this->CacheXSpans(clusterVectorV);
+        this->CacheXSpans(clusterVectorW);
+
+        pXOverlapIndexV.reset(new XOverlapIndex(clusterVectorV, m_xSpanMap));
+        pXOverlapIndexW.reset(new XOverlapIndex(clusterVectorW, m_xSpanMap));
+    }
+
+    if (m_nMainLoopThreads < 2)
+    {
+        for (const Cluster *const pClusterU : clusterVectorU)
+            this->CalculateOverlapResults(pClusterU, clusterVectorV, clusterVectorW, pXOverlapIndexV.get(), pXOverlapIndexW.get());
+
+        return;
+    }
+
+    const unsigned int nClustersU(clusterVectorU.size());
+    std::vector<OverlapResultBuffer> overlapResultBuffers(nClustersU);
+    std::vector<std::exception_ptr> exceptions(nClustersU);
+
+    LArThreadHelper::ParallelFor(nClustersU, m_nMainLoopThreads, [&](const unsigned int indexU) {
+        m_pOverlapResultBuffer = &overlapResultBuffers.at(indexU);
+
+        try
+        {
+            this->CalculateOverlapResults(clusterVectorU.at(indexU), clusterVectorV, clusterVectorW, pXOverlapIndexV.get(), pXOverlapIndexW.get());
+        }
+        catch (...)
+        {
+            exceptions.at(indexU) = std::current_exception();
+        }
+
+        m_pOverlapResultBuffer = nullptr;
+    });
+
+    // ATTN Merge in the serial loop order, stopping at the first u cluster for which an exception was raised, as would a serial loop
+    for (unsigned int indexU = 0; indexU < nClustersU; ++indexU)
+    {
+        for (const BufferedOverlapResult &bufferedResult : overlapResultBuffers.at(indexU))
+        {
+            m_overlapTensor.SetOverlapResult(
+                bufferedResult.m_pClusterU, bufferedResult.m_pClusterV, bufferedResult.m_pClusterW, bufferedResult.m_overlapResult);
+        }
+
+        if (exceptions.at(indexU))
+            std::rethrow_exception(exceptions.at(indexU));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void ThreeViewMatchingControl<T>::CalculateOverlapResults(const Cluster *const pClusterU, const ClusterVector &clusterVectorV,
+    const ClusterVector &clusterVectorW, const XOverlapIndex *const pXOverlapIndexV, const XOverlapIndex *const pXOverlapIndexW)
+{
+    if (!pXOverlapIndexV || !pXOverlapIndexW)
     {
         for (const Cluster *const pClusterV : clusterVectorV)
         {
             for (const Cluster *const pClusterW : clusterVectorW)
                 m_pAlgorithm->CalculateOverlapResult(pClusterU, pClusterV, pClusterW);
         }
+
+        return;
+    }
+
+    // ATTN Cluster combinations are still considered in the same order, but only if their x-spans overlap
+    const XSpan &xSpanU(this->GetXSpan(pClusterU));
+    ClusterVector candidateVectorV, candidateVectorW;
+    pXOverlapIndexV->GetCandidates(xSpanU, m_minCandidateXOverlap, candidateVectorV);
+
+    for (const Cluster *const pClusterV : candidateVectorV)
+    {
+        const XSpan commonXSpanUV(NViewMatchingControl::GetCommonXSpan(xSpanU, this->GetXSpan(pClusterV)));
+        pXOverlapIndexW->GetCandidates(commonXSpanUV, m_minCandidateXOverlap, candidateVectorW);
+
+        for (const Cluster *const pClusterW : candidateVectorW)
+            m_pAlgorithm->CalculateOverlapResult(pClusterU, pClusterV, pClusterW);
     }
 }
 
@@ -244,9 +365,12 @@ StatusCode ThreeViewMatchingControl<T>::ReadSettings(const TiXmlHandle xmlHandle
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameV", m_inputClusterListNameV));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameW", m_inputClusterListNameW));
 
-    return STATUS_CODE_SUCCESS;
+    return this->ReadMainLoopSettings(xmlHandle);
 }
 
+template <typename T>
+thread_local typename ThreeViewMatchingControl<T>::OverlapResultBuffer *ThreeViewMatchingControl<T>::m_pOverlapResultBuffer(nullptr);
+
 template class ThreeViewMatchingControl<float>;
 template class ThreeViewMatchingControl<TransverseOverlapResult>;
 template class ThreeViewMatchingControl<LongitudinalOverlapResult>;
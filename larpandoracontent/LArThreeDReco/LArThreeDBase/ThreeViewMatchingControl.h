@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewMatchingControl.h"
 
+#include <vector>
+
 namespace lar_content
 {
 
@@ -43,7 +45,45 @@ public:
      */
     TensorType &GetOverlapTensor();
 
+    /**
+     *  @brief  Set the overlap result for a cluster triplet. Within a concurrent main loop, the result is buffered by the calling thread and
+     *          only added to the overlap tensor once all triplets have been examined, in the order in which a serial loop would add it.
+     *
+     *  @param  pClusterU address of the u cluster
+     *  @param  pClusterV address of the v cluster
+     *  @param  pClusterW address of the w cluster
+     *  @param  overlapResult the overlap result
+     */
+    void SetOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
+        const pandora::Cluster *const pClusterW, const T &overlapResult);
+
 private:
+    /**
+     *  @brief  BufferedOverlapResult class
+     */
+    class BufferedOverlapResult
+    {
+    public:
+        const pandora::Cluster *m_pClusterU; ///< Address of the u cluster
+        const pandora::Cluster *m_pClusterV; ///< Address of the v cluster
+        const pandora::Cluster *m_pClusterW; ///< Address of the w cluster
+        T m_overlapResult;                   ///< The overlap result
+    };
+
+    typedef std::vector<BufferedOverlapResult> OverlapResultBuffer;
+
+    /**
+     *  @brief  Calculate the overlap results for all combinations involving a specified u cluster, in the standard order
+     *
+     *  @param  pClusterU address of the u cluster
+     *  @param  clusterVectorV the sorted v clusters
+     *  @param  clusterVectorW the sorted w clusters
+     *  @param  pXOverlapIndexV address of the x overlap index for the v clusters, or nullptr if not pre-filtering
+     *  @param  pXOverlapIndexW address of the x overlap index for the w clusters, or nullptr if not pre-filtering
+     */
+    void CalculateOverlapResults(const pandora::Cluster *const pClusterU, const pandora::ClusterVector &clusterVectorV,
+        const pandora::ClusterVector &clusterVectorW, const XOverlapIndex *const pXOverlapIndexV, const XOverlapIndex *const pXOverlapIndexW);
+
     void UpdateForNewCluster(const pandora::Cluster *const pNewCluster);
     void UpdateUponDeletion(const pandora::Cluster *const pDeletedCluster);
     const std::string &GetClusterListName(const pandora::HitType hitType) const;
@@ -69,6 +109,8 @@ private:
     std::string m_inputClusterListNameV; ///< The name of the view V cluster list
     std::string m_inputClusterListNameW; ///< The name of the view W cluster list
 
+    static thread_local OverlapResultBuffer *m_pOverlapResultBuffer; ///< The calling thread's result buffer, within a concurrent main loop
+
     friend class ThreeViewTrackFragmentsAlgorithm; ///< ATTN This is for legacy purposes only
 
     template <typename U>
@@ -9,12 +9,16 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadHelper.h"
 
 #include "larpandoracontent/LArObjects/LArTrackTwoViewOverlapResult.h"
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/MatchingBaseAlgorithm.h"
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/TwoViewMatchingControl.h"
 
+#include <exception>
+#include <memory>
+
 using namespace pandora;
 
 namespace lar_content
@@ -45,6 +49,20 @@ typename TwoViewMatchingControl<T>::MatrixType &TwoViewMatchingControl<T>::GetOv
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void TwoViewMatchingControl<T>::SetOverlapResult(const Cluster *const pCluster1, const Cluster *const pCluster2, const T &overlapResult)
+{
+    if (m_pOverlapResultBuffer)
+    {
+        m_pOverlapResultBuffer->push_back({pCluster1, pCluster2, overlapResult});
+        return;
+    }
+
+    m_overlapMatrix.SetOverlapResult(pCluster1, pCluster2, overlapResult);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void TwoViewMatchingControl<T>::UpdateForNewCluster(const Cluster *const pNewCluster)
 {
@@ -66,6 +84,22 @@ void TwoViewMatchingControl<T>::UpdateForNewCluster(const Cluster *const pNewClu
     ClusterVector clusterVector2(clusterList2.begin(), clusterList2.end());
     std::sort(clusterVector2.begin(), clusterVector2.end(), LArClusterHelper::SortByNHits);
 
+    if (m_useXOverlapPreFilter)
+    {
+        // ATTN Any previously cached x-span for this address is stale
+        m_xSpanMap.erase(pNewCluster);
+        const XSpan newXSpan(this->GetXSpan(pNewCluster));
+
+        ClusterVector candidateVector2;
+        for (const Cluster *const pCluster2 : clusterVector2)
+        {
+            if (this->IsXOverlapCandidate(newXSpan, this->GetXSpan(pCluster2)))
+                candidateVector2.push_back(pCluster2);
+        }
+
+        clusterVector2.swap(candidateVector2);
+    }
+
     for (const Cluster *const pCluster2 : clusterVector2)
     {
         if (1 == iter->second)
@@ -93,6 +127,7 @@ void TwoViewMatchingControl<T>::UpdateUponDeletion(const Cluster *const pDeleted
     if (m_clusterList2.end() != iter2)
         m_clusterList2.erase(iter2);
 
+    m_xSpanMap.erase(pDeletedCluster);
     m_overlapMatrix.RemoveCluster(pDeletedCluster);
 }
 
@@ -194,6 +229,8 @@ void TwoViewMatchingControl<T>::TidyUp()
 
     m_clusterList1.clear();
     m_clusterList2.clear();
+
+    m_xSpanMap.clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -206,11 +243,76 @@ void TwoViewMatchingControl<T>::PerformMainLoop()
     std::sort(clusterVector1.begin(), clusterVector1.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVector2.begin(), clusterVector2.end(), LArClusterHelper::SortByNHits);
 
-    for (const Cluster *const pCluster1 : clusterVector1)
+    std::unique_ptr<XOverlapIndex> pXOverlapIndex2;
+
+    if (m_useXOverlapPreFilter)
+    {
+        // ATTN All x-spans are cached up front, so that the cache is only read within the (possibly concurrent) loop below
+        m_xSpanMap.clear();
+        this->CacheXSpans(clusterVector1);
+        this->CacheXSpans(clusterVector2);
+
+        pXOverlapIndex2.reset(new XOverlapIndex(clusterVector2, m_xSpanMap));
+    }
+
+    if (m_nMainLoopThreads < 2)
+    {
+        for (const Cluster *const pCluster1 : clusterVector1)
+            this->CalculateOverlapResults(pCluster1, clusterVector2, pXOverlapIndex2.get());
+
+        return;
+    }
+
+    const unsigned int nClusters1(clusterVector1.size());
+    std::vector<OverlapResultBuffer> overlapResultBuffers(nClusters1);
+    std::vector<std::exception_ptr> exceptions(nClusters1);
+
+    LArThreadHelper::ParallelFor(nClusters1, m_nMainLoopThreads, [&](const unsigned int index1) {
+        m_pOverlapResultBuffer = &overlapResultBuffers.at(index1);
+
+        try
+        {
+            this->CalculateOverlapResults(clusterVector1.at(index1), clusterVector2, pXOverlapIndex2.get());
+        }
+        catch (...)
+        {
+            exceptions.at(index1) = std::current_exception();
+        }
+
+        m_pOverlapResultBuffer = nullptr;
+    });
+
+    // ATTN Merge in the serial loop order, stopping at the first view 1 cluster for which an exception was raised, as would a serial loop
+    for (unsigned int index1 = 0; index1 < nClusters1; ++index1)
+    {
+        for (const BufferedOverlapResult &bufferedResult : overlapResultBuffers.at(index1))
+            m_overlapMatrix.SetOverlapResult(bufferedResult.m_pCluster1, bufferedResult.m_pCluster2, bufferedResult.m_overlapResult);
+
+        if (exceptions.at(index1))
+            std::rethrow_exception(exceptions.at(index1));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void TwoViewMatchingControl<T>::CalculateOverlapResults(
+    const Cluster *const pCluster1, const ClusterVector &clusterVector2, const XOverlapIndex *const pXOverlapIndex2)
+{
+    if (!pXOverlapIndex2)
     {
         for (const Cluster *const pCluster2 : clusterVector2)
             m_pAlgorithm->CalculateOverlapResult(pCluster1, pCluster2);
+
+        return;
     }
+
+    // ATTN Cluster combinations are still considered in the same order, but only if their x-spans overlap
+    ClusterVector candidateVector2;
+    pXOverlapIndex2->GetCandidates(this->GetXSpan(pCluster1), m_minCandidateXOverlap, candidateVector2);
+
+    for (const Cluster *const pCluster2 : candidateVector2)
+        m_pAlgorithm->CalculateOverlapResult(pCluster1, pCluster2);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -221,9 +323,12 @@ StatusCode TwoViewMatchingControl<T>::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListName1", m_inputClusterListName1));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListName2", m_inputClusterListName2));
 
-    return STATUS_CODE_SUCCESS;
+    return this->ReadMainLoopSettings(xmlHandle);
 }
 
+template <typename T>
+thread_local typename TwoViewMatchingControl<T>::OverlapResultBuffer *TwoViewMatchingControl<T>::m_pOverlapResultBuffer(nullptr);
+
 template class TwoViewMatchingControl<float>;
 template class TwoViewMatchingControl<TwoViewTransverseOverlapResult>;
 
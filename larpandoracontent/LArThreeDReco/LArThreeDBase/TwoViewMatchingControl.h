@@ -13,6 +13,7 @@
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/NViewMatchingControl.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace lar_content
 {
@@ -45,7 +46,40 @@ public:
      */
     MatrixType &GetOverlapMatrix();
 
+    /**
+     *  @brief  Set the overlap result for a cluster pair. Within a concurrent main loop, the result is buffered by the calling thread and
+     *          only added to the overlap matrix once all pairs have been examined, in the order in which a serial loop would add it.
+     *
+     *  @param  pCluster1 address of the view 1 cluster
+     *  @param  pCluster2 address of the view 2 cluster
+     *  @param  overlapResult the overlap result
+     */
+    void SetOverlapResult(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, const T &overlapResult);
+
 private:
+    /**
+     *  @brief  BufferedOverlapResult class
+     */
+    class BufferedOverlapResult
+    {
+    public:
+        const pandora::Cluster *m_pCluster1; ///< Address of the view 1 cluster
+        const pandora::Cluster *m_pCluster2; ///< Address of the view 2 cluster
+        T m_overlapResult;                   ///< The overlap result
+    };
+
+    typedef std::vector<BufferedOverlapResult> OverlapResultBuffer;
+
+    /**
+     *  @brief  Calculate the overlap results for all combinations involving a specified view 1 cluster, in the standard order
+     *
+     *  @param  pCluster1 address of the view 1 cluster
+     *  @param  clusterVector2 the sorted view 2 clusters
+     *  @param  pXOverlapIndex2 address of the x overlap index for the view 2 clusters, or nullptr if not pre-filtering
+     */
+    void CalculateOverlapResults(
+        const pandora::Cluster *const pCluster1, const pandora::ClusterVector &clusterVector2, const XOverlapIndex *const pXOverlapIndex2);
+
     void UpdateForNewCluster(const pandora::Cluster *const pNewCluster);
     void UpdateUponDeletion(const pandora::Cluster *const pDeletedCluster);
     const std::string &GetClusterListName(const pandora::HitType hitType) const;
@@ -71,6 +105,8 @@ private:
     std::string m_inputClusterListName1; ///< The name of the view 1 cluster list
     std::string m_inputClusterListName2; ///< The name of the view 2 cluster list
 
+    static thread_local OverlapResultBuffer *m_pOverlapResultBuffer; ///< The calling thread's result buffer, within a concurrent main loop
+
     template <typename U>
     friend class NViewMatchingAlgorithm;
 };
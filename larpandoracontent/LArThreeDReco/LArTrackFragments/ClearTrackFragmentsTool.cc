@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArThreeDReco/LArTrackFragments/ClearTrackFragmentsTool.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 using namespace pandora;
 
@@ -312,11 +313,15 @@ void ClearTrackFragmentsTool::Recluster(ThreeViewTrackFragmentsAlgorithm *const
                 throw StatusCodeException(STATUS_CODE_FAILURE);
 
             (void)deletedClusters.insert(pCluster);
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pFragmentCluster);
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pCluster);
             PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*pAlgorithm, pFragmentCluster, pCluster));
         }
     }
     else
     {
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pCluster);
+
         for (const CaloHit *const pCaloHit : daughterHits)
             PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RemoveFromCluster(*pAlgorithm, pCluster, pCaloHit));
 
@@ -338,6 +343,7 @@ void ClearTrackFragmentsTool::Recluster(ThreeViewTrackFragmentsAlgorithm *const
         }
         else
         {
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pFragmentCluster);
             PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::AddToCluster(*pAlgorithm, pFragmentCluster, &daughterHits));
         }
     }
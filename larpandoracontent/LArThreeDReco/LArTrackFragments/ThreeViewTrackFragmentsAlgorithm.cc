@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArThreeDReco/LArTrackFragments/ThreeViewTrackFragmentsAlgorithm.h"
 
@@ -59,6 +60,9 @@ void ThreeViewTrackFragmentsAlgorithm::UpdateForNewCluster(const Cluster *const
 
     clusterList.push_back(pNewCluster);
 
+    // ATTN Any previously cached x-span for this address is stale
+    matchingControl.m_xSpanMap.erase(pNewCluster);
+
     ClusterList clusterList1(this->GetSelectedClusterList((TPC_VIEW_U == hitType) ? TPC_VIEW_V : TPC_VIEW_U));
     ClusterList clusterList2(this->GetSelectedClusterList((TPC_VIEW_W == hitType) ? TPC_VIEW_V : TPC_VIEW_W));
     clusterList1.sort(LArClusterHelper::SortByNHits);
@@ -66,6 +70,9 @@ void ThreeViewTrackFragmentsAlgorithm::UpdateForNewCluster(const Cluster *const
 
     for (const Cluster *const pCluster1 : clusterList1)
     {
+        if (!this->PassesXOverlapPreFilter(pNewCluster, pCluster1))
+            continue;
+
         if (TPC_VIEW_U == hitType)
         {
             this->CalculateOverlapResult(pNewCluster, pCluster1, nullptr);
@@ -82,6 +89,9 @@ void ThreeViewTrackFragmentsAlgorithm::UpdateForNewCluster(const Cluster *const
 
     for (const Cluster *const pCluster2 : clusterList2)
     {
+        if (!this->PassesXOverlapPreFilter(pNewCluster, pCluster2))
+            continue;
+
         if (TPC_VIEW_U == hitType)
         {
             this->CalculateOverlapResult(pNewCluster, nullptr, pCluster2);
@@ -109,6 +119,7 @@ void ThreeViewTrackFragmentsAlgorithm::RebuildClusters(const ClusterList &rebuil
         PandoraContentApi::RunClusteringAlgorithm(*this, m_reclusteringAlgorithmName, pNewClusterList, newClusterListName));
 
     newClusters.insert(newClusters.end(), pNewClusterList->begin(), pNewClusterList->end());
+    LArSlidingFitCacheHelper::InvalidateClusters(this->GetPandora(), rebuildList);
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndReclustering(*this, newClusterListName));
 }
 
@@ -123,22 +134,35 @@ void ThreeViewTrackFragmentsAlgorithm::PerformMainLoop()
     clusterListV.sort(LArClusterHelper::SortByNHits);
     clusterListW.sort(LArClusterHelper::SortByNHits);
 
+    // ATTN This is non-standard usage, supported here only (for legacy purposes). The loop is always serial, as results depend on insertion
+    // order, so this algorithm does not opt in via IsOverlapCalculationThreadSafe and NMainLoopThreads > 1 is rejected in ReadSettings
+    this->GetMatchingControl().m_xSpanMap.clear();
+
     for (const Cluster *const pClusterU : clusterListU)
     {
         for (const Cluster *const pClusterV : clusterListV)
-            this->CalculateOverlapResult(pClusterU, pClusterV, nullptr);
+        {
+            if (this->PassesXOverlapPreFilter(pClusterU, pClusterV))
+                this->CalculateOverlapResult(pClusterU, pClusterV, nullptr);
+        }
     }
 
     for (const Cluster *const pClusterU : clusterListU)
     {
         for (const Cluster *const pClusterW : clusterListW)
-            this->CalculateOverlapResult(pClusterU, nullptr, pClusterW);
+        {
+            if (this->PassesXOverlapPreFilter(pClusterU, pClusterW))
+                this->CalculateOverlapResult(pClusterU, nullptr, pClusterW);
+        }
     }
 
     for (const Cluster *const pClusterV : clusterListV)
     {
         for (const Cluster *const pClusterW : clusterListW)
-            this->CalculateOverlapResult(nullptr, pClusterV, pClusterW);
+        {
+            if (this->PassesXOverlapPreFilter(pClusterV, pClusterW))
+                this->CalculateOverlapResult(nullptr, pClusterV, pClusterW);
+        }
     }
 }
 
@@ -270,6 +294,19 @@ StatusCode ThreeViewTrackFragmentsAlgorithm::CalculateOverlapResult(const TwoDSl
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool ThreeViewTrackFragmentsAlgorithm::PassesXOverlapPreFilter(const Cluster *const pCluster1, const Cluster *const pCluster2)
+{
+    // ATTN This is non-standard usage, supported here only (for legacy purposes)
+    MatchingType &matchingControl(this->GetMatchingControl());
+
+    if (!matchingControl.m_useXOverlapPreFilter)
+        return true;
+
+    return matchingControl.IsXOverlapCandidate(matchingControl.GetXSpan(pCluster1), matchingControl.GetXSpan(pCluster2));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeViewTrackFragmentsAlgorithm::GetProjectedPositions(
     const TwoDSlidingFitResult &fitResult1, const TwoDSlidingFitResult &fitResult2, CartesianPointVector &projectedPositions) const
 {
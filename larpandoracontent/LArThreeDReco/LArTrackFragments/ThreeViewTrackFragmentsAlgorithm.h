@@ -66,6 +66,16 @@ protected:
     pandora::StatusCode CalculateOverlapResult(const TwoDSlidingFitResult &fitResult1, const TwoDSlidingFitResult &fitResult2,
         const pandora::ClusterList &inputClusterList, const pandora::Cluster *&pBestMatchedCluster, FragmentOverlapResult &fragmentOverlapResult) const;
 
+    /**
+     *  @brief  Whether a pair of clusters passes the matching control x overlap pre-filter (always true if pre-filtering is disabled)
+     *
+     *  @param  pCluster1 address of the first cluster
+     *  @param  pCluster2 address of the second cluster
+     *
+     *  @return boolean
+     */
+    bool PassesXOverlapPreFilter(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2);
+
     typedef std::unordered_map<const pandora::CaloHit *, const pandora::Cluster *> HitToClusterMap;
 
     /**
@@ -28,29 +28,37 @@ TwoViewTransverseTracksAlgorithm::TwoViewTransverseTracksAlgorithm() :
     m_localMatchingScoreThreshold(0.99f),
     m_maxDotProduct(0.998f),
     m_minOverallMatchingScore(0.1f),
-    m_minOverallLocallyMatchedFraction(0.1f),
-    m_randomNumberGenerator(static_cast<std::mt19937::result_type>(0))
+    m_minOverallLocallyMatchedFraction(0.1f)
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool TwoViewTransverseTracksAlgorithm::IsOverlapCalculationThreadSafe() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void TwoViewTransverseTracksAlgorithm::CalculateOverlapResult(const Cluster *const pCluster1, const Cluster *const pCluster2, const Cluster *const)
 {
-    m_randomNumberGenerator.seed(
+    // ATTN Generator is local to each cluster pair, so that results do not depend upon the order (or thread) in which pairs are examined
+    std::mt19937 randomNumberGenerator(
         static_cast<std::mt19937::result_type>(pCluster1->GetOrderedCaloHitList().size() + pCluster2->GetOrderedCaloHitList().size()));
 
     TwoViewTransverseOverlapResult overlapResult;
-    PANDORA_THROW_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, this->CalculateOverlapResult(pCluster1, pCluster2, overlapResult));
+    PANDORA_THROW_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        this->CalculateOverlapResult(pCluster1, pCluster2, randomNumberGenerator, overlapResult));
 
     if (overlapResult.IsInitialized())
-        this->GetMatchingControl().GetOverlapMatrix().SetOverlapResult(pCluster1, pCluster2, overlapResult);
+        this->GetMatchingControl().SetOverlapResult(pCluster1, pCluster2, overlapResult);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-pandora::StatusCode TwoViewTransverseTracksAlgorithm::CalculateOverlapResult(
-    const Cluster *const pCluster1, const Cluster *const pCluster2, TwoViewTransverseOverlapResult &overlapResult)
+pandora::StatusCode TwoViewTransverseTracksAlgorithm::CalculateOverlapResult(const Cluster *const pCluster1, const Cluster *const pCluster2,
+    std::mt19937 &randomNumberGenerator, TwoViewTransverseOverlapResult &overlapResult)
 {
     UIntSet daughterVolumeIntersection;
     LArGeometryHelper::GetCommonDaughterVolumes(pCluster1, pCluster2, daughterVolumeIntersection);
@@ -118,14 +126,14 @@ pandora::StatusCode TwoViewTransverseTracksAlgorithm::CalculateOverlapResult(
         LArDiscreteProbabilityHelper::CalculateCorrelationCoefficient(resampledDiscreteProbabilityVector1, resampledDiscreteProbabilityVector2));
 
     const float pvalue(LArDiscreteProbabilityHelper::CalculateCorrelationCoefficientPValueFromPermutationTest(
-        resampledDiscreteProbabilityVector1, resampledDiscreteProbabilityVector2, m_randomNumberGenerator, m_nPermutations));
+        resampledDiscreteProbabilityVector1, resampledDiscreteProbabilityVector2, randomNumberGenerator, m_nPermutations));
 
     const float matchingScore(1.f - pvalue);
     if (matchingScore < m_minOverallMatchingScore)
         return STATUS_CODE_NOT_FOUND;
 
     const unsigned int nLocallyMatchedSamplingPoints(this->CalculateNumberOfLocallyMatchingSamplingPoints(
-        resampledDiscreteProbabilityVector1, resampledDiscreteProbabilityVector2, m_randomNumberGenerator));
+        resampledDiscreteProbabilityVector1, resampledDiscreteProbabilityVector2, randomNumberGenerator));
     const int nComparisons(static_cast<int>(resampledDiscreteProbabilityVector1.GetSize()) - (static_cast<int>(m_minSamples) - 1));
     if (1 > nComparisons)
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
@@ -42,16 +42,18 @@ public:
 
 private:
     void CalculateOverlapResult(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, const pandora::Cluster *const);
+    bool IsOverlapCalculationThreadSafe() const;
 
     /**
      *  @brief  Calculates the two view overlap result
      *
      *  @param  pCluster1 the view 0 cluster
      *  @param  pCluster2 the view 1 cluster
+     *  @param  randomNumberGenerator a seeded random number generator
      *  @param  overlapResult the two view overlap result
      */
-    pandora::StatusCode CalculateOverlapResult(
-        const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, TwoViewTransverseOverlapResult &overlapResult);
+    pandora::StatusCode CalculateOverlapResult(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2,
+        std::mt19937 &randomNumberGenerator, TwoViewTransverseOverlapResult &overlapResult);
 
     /**
      *  @brief  Calculates the number of the sliding windows that contains charge bins that locally match
@@ -88,7 +90,6 @@ private:
     float m_maxDotProduct;                    ///M The maximum allowed cluster primary qxis Dot drift axis to fill the overlap result
     float m_minOverallMatchingScore;          ///< The minimum required global matching score to fill the overlap result
     float m_minOverallLocallyMatchedFraction; ///< The minimum required lcoally matched fraction to fill the overlap result
-    std::mt19937 m_randomNumberGenerator;     ///< The random number generator
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -48,7 +48,12 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const Cluster *const pClus
     if (pCluster->GetNCaloHits() < m_minCaloHitsCut)
         return false;
 
-    const LArMvaHelper::MvaFeatureVector featureVector(LArMvaHelper::CalculateFeatures(m_featureToolVector, this, pCluster));
+    // ATTN Feature names are only needed by a binary training output file awaiting its schema, and are then found in the same pass
+    StringVector featureNames;
+    const bool nameFeatures(m_trainingSetMode && m_pTrainingWriter->NeedsFeatureNames(m_trainingOutputFile));
+    const LArMvaHelper::MvaFeatureVector featureVector(
+        nameFeatures ? LArMvaHelper::CalculateFeaturesAndNames(m_featureToolVector, featureNames, this, pCluster)
+                     : LArMvaHelper::CalculateFeatures(m_featureToolVector, this, pCluster));
 
     if (m_trainingSetMode)
     {
@@ -63,7 +68,10 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const Cluster *const pClus
         {
         }
 
-        LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, isTrueTrack, featureVector);
+        if (!featureNames.empty())
+            m_pTrainingWriter->SetFeatureNames(m_trainingOutputFile, featureNames);
+
+        LArMvaHelper::ProduceTrainingExample(*m_pTrainingWriter, m_trainingOutputFile, isTrueTrack, featureVector);
         return isTrueTrack;
     }
 
@@ -99,7 +107,14 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
 
     const PfoCharacterisationFeatureTool::FeatureToolVector &chosenFeatureToolVector(
         wClusterList.empty() ? m_featureToolVectorNoChargeInfo : m_featureToolVectorThreeD);
-    const LArMvaHelper::MvaFeatureVector featureVector(LArMvaHelper::CalculateFeatures(chosenFeatureToolVector, this, pPfo));
+
+    // ATTN Feature names are only needed by a binary training output file awaiting its schema, and are then found in the same pass
+    StringVector featureNames;
+    const bool nameFeatures(m_trainingSetMode &&
+        m_pTrainingWriter->NeedsFeatureNames(m_trainingOutputFile + (wClusterList.empty() ? "noChargeInfo.txt" : ".txt")));
+    const LArMvaHelper::MvaFeatureVector featureVector(
+        nameFeatures ? LArMvaHelper::CalculateFeaturesAndNames(chosenFeatureToolVector, featureNames, this, pPfo)
+                     : LArMvaHelper::CalculateFeatures(chosenFeatureToolVector, this, pPfo));
 
     if (m_trainingSetMode && m_applyReconstructabilityChecks)
     {
@@ -211,7 +226,11 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
                 std::string outputFile(m_trainingOutputFile);
                 const std::string end = ((wClusterList.empty()) ? "noChargeInfo.txt" : ".txt");
                 outputFile.append(end);
-                LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, featureVector);
+
+                if (!featureNames.empty())
+                    m_pTrainingWriter->SetFeatureNames(outputFile, featureNames);
+
+                LArMvaHelper::ProduceTrainingExample(*m_pTrainingWriter, outputFile, isTrueTrack, featureVector);
             }
         }
 
@@ -236,7 +255,11 @@ bool MvaPfoCharacterisationAlgorithm<T>::IsClearTrack(const pandora::ParticleFlo
         {
             std::string outputFile(m_trainingOutputFile);
             outputFile.append(wClusterList.empty() ? "noChargeInfo.txt" : ".txt");
-            LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, featureVector);
+
+            if (!featureNames.empty())
+                m_pTrainingWriter->SetFeatureNames(outputFile, featureNames);
+
+            LArMvaHelper::ProduceTrainingExample(*m_pTrainingWriter, outputFile, isTrueTrack, featureVector);
         }
 
         return isTrueTrack;
@@ -344,6 +367,7 @@ StatusCode MvaPfoCharacterisationAlgorithm<T>::ReadSettings(const TiXmlHandle xm
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "CaloHitListName", m_caloHitListName));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "MCParticleListName", m_mcParticleListName));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFileName", m_trainingOutputFile));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, MvaTrainingWriter::Create(xmlHandle, m_pTrainingWriter));
         PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "TestBeamMode", m_testBeamMode));
         PANDORA_RETURN_RESULT_IF_AND_IF(
             STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "ApplyFiducialCut", m_applyFiducialCut));
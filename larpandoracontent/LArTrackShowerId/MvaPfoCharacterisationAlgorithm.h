@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
 
 #include "larpandoracontent/LArObjects/LArAdaBoostDecisionTree.h"
+#include "larpandoracontent/LArObjects/LArMvaTrainingWriter.h"
 #include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
 
 #include "larpandoracontent/LArTrackShowerId/PfoCharacterisationBaseAlgorithm.h"
@@ -68,6 +69,8 @@ protected:
     std::string m_mvaFileNameNoChargeInfo;     ///< The mva input file for PFOs missing the W view, and thus charge info
     std::string m_mvaNameNoChargeInfo;         ///< The name of the mva to find for PFOs missing the W view, and thus charge info
 
+    std::unique_ptr<MvaTrainingWriter> m_pTrainingWriter; ///< The writer for training examples, keeping the output files open
+
     LArMCParticleHelper::PrimaryParameters m_primaryParameters; ///< The mc particle primary selection parameters
 
 private:
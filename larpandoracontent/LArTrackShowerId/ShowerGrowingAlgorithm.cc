@@ -12,6 +12,7 @@
 
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 
@@ -263,6 +264,8 @@ void ShowerGrowingAlgorithm::ProcessBranchClusters(const Cluster *const pParentC
     {
         if (pBranchCluster->IsAvailable())
         {
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pParentCluster);
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pBranchCluster);
             PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
                 PandoraContentApi::MergeAndDeleteClusters(*this, pParentCluster, pBranchCluster, listName, listName));
         }
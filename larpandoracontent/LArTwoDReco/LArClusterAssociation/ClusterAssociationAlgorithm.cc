@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterAssociationAlgorithm.h"
 
@@ -33,7 +34,10 @@ StatusCode ClusterAssociationAlgorithm::Run()
 
     ClusterAssociationMap clusterAssociationMap;
     this->PopulateClusterAssociationMap(clusterVector, clusterAssociationMap);
+    this->FillReferenceMap(clusterAssociationMap);
 
+    m_liveClusters = ClusterSet(clusterVector.begin(), clusterVector.end());
+    m_changedClusters = m_liveClusters;
     m_mergeMade = true;
 
     while (m_mergeMade)
@@ -45,8 +49,12 @@ StatusCode ClusterAssociationAlgorithm::Run()
 
             for (const Cluster *const pCluster : clusterVector)
             {
-                // ATTN The clusterVector may end up with dangling pointers; only protected by this check against managed cluster list
-                if (pClusterList->end() == std::find(pClusterList->begin(), pClusterList->end(), pCluster))
+                // ATTN The clusterVector may end up with dangling pointers; only protected by this check against the live clusters
+                if (!m_liveClusters.count(pCluster))
+                    continue;
+
+                // Propagation of a cluster can only change its associations if they, or those of an associated cluster, have changed
+                if (!m_changedClusters.erase(pCluster))
                     continue;
 
                 this->UnambiguousPropagation(pCluster, true, clusterAssociationMap);
@@ -74,11 +82,58 @@ StatusCode ClusterAssociationAlgorithm::Run()
         }
     }
 
+    m_liveClusters.clear();
+    m_changedClusters.clear();
+    m_clusterReferenceMap.clear();
+
     return STATUS_CODE_SUCCESS;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ClusterAssociationAlgorithm::FillReferenceMap(const ClusterAssociationMap &clusterAssociationMap) const
+{
+    m_clusterReferenceMap.clear();
+
+    for (const ClusterAssociationMap::value_type &mapEntry : clusterAssociationMap)
+    {
+        for (const Cluster *const pForwardCluster : mapEntry.second.m_forwardAssociations)
+            (void)m_clusterReferenceMap[pForwardCluster].insert(mapEntry.first);
+
+        for (const Cluster *const pBackwardCluster : mapEntry.second.m_backwardAssociations)
+            (void)m_clusterReferenceMap[pBackwardCluster].insert(mapEntry.first);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterAssociationAlgorithm::MarkAsChanged(const Cluster *const pCluster) const
+{
+    if (m_liveClusters.count(pCluster))
+        (void)m_changedClusters.insert(pCluster);
+
+    ClusterReferenceMap::const_iterator iter = m_clusterReferenceMap.find(pCluster);
+
+    if (m_clusterReferenceMap.end() == iter)
+        return;
+
+    for (const Cluster *const pReferencingCluster : iter->second)
+    {
+        if (m_liveClusters.count(pReferencingCluster))
+            (void)m_changedClusters.insert(pReferencingCluster);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterAssociationAlgorithm::MarkAsDeleted(const Cluster *const pCluster) const
+{
+    (void)m_liveClusters.erase(pCluster);
+    (void)m_changedClusters.erase(pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ClusterAssociationAlgorithm::UnambiguousPropagation(const Cluster *const pCluster, const bool isForward, ClusterAssociationMap &clusterAssociationMap) const
 {
     const Cluster *const pClusterToEnlarge = pCluster;
@@ -105,7 +160,10 @@ void ClusterAssociationAlgorithm::UnambiguousPropagation(const Cluster *const pC
 
     this->UpdateForUnambiguousMerge(pClusterToEnlarge, pClusterToDelete, isForward, clusterAssociationMap);
 
+    LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pClusterToEnlarge);
+    LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pClusterToDelete);
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pClusterToEnlarge, pClusterToDelete));
+    this->MarkAsDeleted(pClusterToDelete);
     m_mergeMade = true;
 
     this->UnambiguousPropagation(pClusterToEnlarge, isForward, clusterAssociationMap);
@@ -148,7 +206,10 @@ void ClusterAssociationAlgorithm::AmbiguousPropagation(const Cluster *const pClu
     {
         this->UpdateForAmbiguousMerge(*dIter, clusterAssociationMap);
 
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pCluster);
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), *dIter);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pCluster, *dIter));
+        this->MarkAsDeleted(*dIter);
         m_mergeMade = true;
         *dIter = NULL;
     }
@@ -172,26 +233,48 @@ void ClusterAssociationAlgorithm::UpdateForUnambiguousMerge(const Cluster *const
     clusterSetToReplace = clusterSetToMove;
     clusterAssociationMap.erase(iterDelete);
 
-    for (ClusterAssociationMap::iterator iter = clusterAssociationMap.begin(), iterEnd = clusterAssociationMap.end(); iter != iterEnd; ++iter)
+    for (const Cluster *const pMovedCluster : clusterSetToReplace)
+        (void)m_clusterReferenceMap[pMovedCluster].insert(pClusterToEnlarge);
+
+    // Only the clusters whose associations include the deleted cluster need updating
+    const ClusterSet &referencingClusters(m_clusterReferenceMap[pClusterToDelete]);
+    const ClusterVector referencingClusterVector(referencingClusters.begin(), referencingClusters.end());
+
+    for (const Cluster *const pReferencingCluster : referencingClusterVector)
     {
+        ClusterAssociationMap::iterator iter = clusterAssociationMap.find(pReferencingCluster);
+
+        if (clusterAssociationMap.end() == iter)
+            continue;
+
         ClusterSet &forwardClusters = iter->second.m_forwardAssociations;
         ClusterSet &backwardClusters = iter->second.m_backwardAssociations;
 
         ClusterSet::iterator forwardIter = forwardClusters.find(pClusterToDelete);
         ClusterSet::iterator backwardIter = backwardClusters.find(pClusterToDelete);
+        const bool isForwardReference(forwardClusters.end() != forwardIter), isBackwardReference(backwardClusters.end() != backwardIter);
 
-        if (forwardClusters.end() != forwardIter)
+        if (isForwardReference)
         {
             forwardClusters.erase(forwardIter);
             forwardClusters.insert(pClusterToEnlarge);
         }
 
-        if (backwardClusters.end() != backwardIter)
+        if (isBackwardReference)
         {
             backwardClusters.erase(backwardIter);
             backwardClusters.insert(pClusterToEnlarge);
         }
+
+        if (isForwardReference || isBackwardReference)
+        {
+            (void)m_clusterReferenceMap[pClusterToEnlarge].insert(pReferencingCluster);
+            this->MarkAsChanged(pReferencingCluster);
+        }
     }
+
+    this->MarkAsChanged(pClusterToEnlarge);
+    this->MarkAsChanged(pClusterToDelete);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -203,22 +286,36 @@ void ClusterAssociationAlgorithm::UpdateForAmbiguousMerge(const Cluster *const p
     if (clusterAssociationMap.end() == cIter)
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    for (ClusterAssociationMap::iterator mIter = clusterAssociationMap.begin(), mIterEnd = clusterAssociationMap.end(); mIter != mIterEnd; ++mIter)
+    // Only the clusters whose associations include the cluster need updating
+    const ClusterSet &referencingClusters(m_clusterReferenceMap[pCluster]);
+    const ClusterVector referencingClusterVector(referencingClusters.begin(), referencingClusters.end());
+
+    for (const Cluster *const pReferencingCluster : referencingClusterVector)
     {
+        ClusterAssociationMap::iterator mIter = clusterAssociationMap.find(pReferencingCluster);
+
+        if (clusterAssociationMap.end() == mIter)
+            continue;
+
         ClusterSet &forwardClusters = mIter->second.m_forwardAssociations;
         ClusterSet &backwardClusters = mIter->second.m_backwardAssociations;
 
         ClusterSet::iterator fIter = forwardClusters.find(pCluster);
         ClusterSet::iterator bIter = backwardClusters.find(pCluster);
+        const bool isForwardReference(forwardClusters.end() != fIter), isBackwardReference(backwardClusters.end() != bIter);
 
-        if (forwardClusters.end() != fIter)
+        if (isForwardReference)
             forwardClusters.erase(fIter);
 
-        if (backwardClusters.end() != bIter)
+        if (isBackwardReference)
             backwardClusters.erase(bIter);
+
+        if (isForwardReference || isBackwardReference)
+            this->MarkAsChanged(pReferencingCluster);
     }
 
     clusterAssociationMap.erase(pCluster);
+    this->MarkAsChanged(pCluster);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -71,6 +71,30 @@ protected:
         const bool isForward, const pandora::Cluster *const pCurrentCluster, const pandora::Cluster *const pTestCluster) const = 0;
 
 private:
+    typedef std::unordered_map<const pandora::Cluster *, pandora::ClusterSet> ClusterReferenceMap;
+
+    /**
+     *  @brief  Index the cluster association map, recording for each cluster the clusters whose associations include it
+     *
+     *  @param  clusterAssociationMap the cluster association map
+     */
+    void FillReferenceMap(const ClusterAssociationMap &clusterAssociationMap) const;
+
+    /**
+     *  @brief  Record that the associations of a cluster have changed, so that it, and any clusters associated with it, are revisited
+     *          during unambiguous propagation
+     *
+     *  @param  pCluster address of the cluster
+     */
+    void MarkAsChanged(const pandora::Cluster *const pCluster) const;
+
+    /**
+     *  @brief  Record that a cluster has been deleted by a merge
+     *
+     *  @param  pCluster address of the deleted cluster
+     */
+    void MarkAsDeleted(const pandora::Cluster *const pCluster) const;
+
     /**
      *  @brief  Unambiguous propagation
      *
@@ -121,6 +145,9 @@ private:
         const bool isForward, const pandora::Cluster *&pExtremalCluster, pandora::ClusterSet &clusterSet) const;
 
     mutable bool m_mergeMade;
+    mutable pandora::ClusterSet m_liveClusters;        ///< The clean clusters not yet deleted by merges
+    mutable pandora::ClusterSet m_changedClusters;     ///< The live clusters to revisit, as their associations may have changed
+    mutable ClusterReferenceMap m_clusterReferenceMap; ///< The clusters whose associations include (or once included) each cluster
 
     bool m_resolveAmbiguousAssociations; ///< Whether to resolve ambiguous associations
 };
@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterGrowingAlgorithm.h"
 
@@ -134,10 +135,14 @@ void ClusterGrowingAlgorithm::MergeClusters(const ClusterMergeMap &clusterMergeM
         {
             if (m_inputClusterListName.empty())
             {
+                LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pParentCluster);
+                LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pAssociatedCluster);
                 PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pParentCluster, pAssociatedCluster));
             }
             else
             {
+                LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pParentCluster);
+                LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pAssociatedCluster);
                 PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
                     PandoraContentApi::MergeAndDeleteClusters(*this, pParentCluster, pAssociatedCluster, m_inputClusterListName, m_inputClusterListName));
             }
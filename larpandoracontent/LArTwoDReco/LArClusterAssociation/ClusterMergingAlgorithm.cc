@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterMergingAlgorithm.h"
 
@@ -17,6 +18,12 @@ using namespace pandora;
 namespace lar_content
 {
 
+ClusterMergingAlgorithm::ClusterMergingAlgorithm() : m_incrementalMerging(true)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ClusterMergingAlgorithm::Run()
 {
     const ClusterList *pClusterList = NULL;
@@ -39,6 +46,9 @@ StatusCode ClusterMergingAlgorithm::Run()
         return STATUS_CODE_SUCCESS;
     }
 
+    const bool isIncremental(m_incrementalMerging && this->HasPairwiseAssociations());
+    ClusterSet unassociatedClusters;
+
     while (true)
     {
         ClusterVector unsortedVector, clusterVector;
@@ -46,11 +56,31 @@ StatusCode ClusterMergingAlgorithm::Run()
         this->GetSortedListOfCleanClusters(unsortedVector, clusterVector);
 
         ClusterMergeMap clusterMergeMap;
-        this->PopulateClusterMergeMap(clusterVector, clusterMergeMap);
+
+        if (isIncremental)
+        {
+            this->UpdateClusterMergeMap(clusterVector, unassociatedClusters, clusterMergeMap);
+        }
+        else
+        {
+            this->PopulateClusterMergeMap(clusterVector, clusterMergeMap);
+        }
 
         if (clusterMergeMap.empty())
             break;
 
+        // ATTN Only associated clusters are merged or deleted, so the unassociated clusters remain unassociated with one another
+        if (isIncremental)
+        {
+            unassociatedClusters.clear();
+
+            for (const Cluster *const pCluster : clusterVector)
+            {
+                if (!clusterMergeMap.count(pCluster))
+                    (void)unassociatedClusters.insert(pCluster);
+            }
+        }
+
         this->MergeClusters(clusterVector, clusterMergeMap);
     }
 
@@ -59,6 +89,50 @@ StatusCode ClusterMergingAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool ClusterMergingAlgorithm::HasPairwiseAssociations() const
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ClusterMergingAlgorithm::IsPairwiseAssociated(const Cluster *const, const Cluster *const) const
+{
+    throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterMergingAlgorithm::UpdateClusterMergeMap(
+    const ClusterVector &clusterVector, const ClusterSet &unassociatedClusters, ClusterMergeMap &clusterMergeMap) const
+{
+    std::vector<bool> isUnassociated;
+
+    for (const Cluster *const pCluster : clusterVector)
+        isUnassociated.push_back(unassociatedClusters.count(pCluster) > 0);
+
+    for (unsigned int i = 0; i < clusterVector.size(); ++i)
+    {
+        const Cluster *const pClusterI(clusterVector.at(i));
+
+        for (unsigned int j = i + 1; j < clusterVector.size(); ++j)
+        {
+            const Cluster *const pClusterJ(clusterVector.at(j));
+
+            if ((pClusterI == pClusterJ) || (isUnassociated.at(i) && isUnassociated.at(j)))
+                continue;
+
+            if (this->IsPairwiseAssociated(pClusterI, pClusterJ))
+            {
+                clusterMergeMap[pClusterI].push_back(pClusterJ);
+                clusterMergeMap[pClusterJ].push_back(pClusterI);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ClusterMergingAlgorithm::MergeClusters(ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap) const
 {
     ClusterSet clusterVetoList;
@@ -81,10 +155,14 @@ void ClusterMergingAlgorithm::MergeClusters(ClusterVector &clusterVector, Cluste
 
             if (m_inputClusterListName.empty())
             {
+                LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pSeedCluster);
+                LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pAssociatedCluster);
                 PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pSeedCluster, pAssociatedCluster));
             }
             else
             {
+                LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pSeedCluster);
+                LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pAssociatedCluster);
                 PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
                     PandoraContentApi::MergeAndDeleteClusters(*this, pSeedCluster, pAssociatedCluster, m_inputClusterListName, m_inputClusterListName));
             }
@@ -164,6 +242,9 @@ StatusCode ClusterMergingAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListName", m_inputClusterListName));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "IncrementalMerging", m_incrementalMerging));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -20,6 +20,12 @@ namespace lar_content
  */
 class ClusterMergingAlgorithm : public pandora::Algorithm
 {
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    ClusterMergingAlgorithm();
+
 protected:
     virtual pandora::StatusCode Run();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -42,6 +48,36 @@ protected:
      */
     virtual void PopulateClusterMergeMap(const pandora::ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap) const = 0;
 
+    /**
+     *  @brief  Whether the cluster merge map is populated by testing each pair of clean clusters independently, using IsPairwiseAssociated.
+     *          If so, and incremental merging is enabled, only pairs involving new or merged clusters are tested after the first pass.
+     *
+     *  @return boolean
+     */
+    virtual bool HasPairwiseAssociations() const;
+
+    /**
+     *  @brief  Decide whether a pair of clean clusters is associated, for algorithms with pairwise associations
+     *
+     *  @param  pClusterI address of the first cluster, which precedes the second in the sorted vector of clean clusters
+     *  @param  pClusterJ address of the second cluster
+     *
+     *  @return boolean
+     */
+    virtual bool IsPairwiseAssociated(const pandora::Cluster *const pClusterI, const pandora::Cluster *const pClusterJ) const;
+
+    /**
+     *  @brief  Populate the cluster merge map for algorithms with pairwise associations, skipping pairs of clusters already known to be
+     *          unassociated. The map is identical to that from a full pass over all pairs.
+     *
+     *  @param  clusterVector the vector of clean clusters
+     *  @param  unassociatedClusters the clusters known to be unassociated with one another, since they were unassociated clean clusters in
+     *          the previous pass and so are unchanged by its merges
+     *  @param  clusterMergeMap the matrix of cluster associations
+     */
+    void UpdateClusterMergeMap(const pandora::ClusterVector &clusterVector, const pandora::ClusterSet &unassociatedClusters,
+        ClusterMergeMap &clusterMergeMap) const;
+
     /**
      *  @brief  Merge associated clusters
      *
@@ -81,6 +117,7 @@ protected:
     void GetSortedListOfCleanClusters(const pandora::ClusterVector &inputClusters, pandora::ClusterVector &outputClusters) const;
 
     std::string m_inputClusterListName; ///< The name of the input cluster list. If not specified, will access current list.
+    bool m_incrementalMerging;          ///< Whether to test only pairs involving new or merged clusters, for pairwise associations
 };
 
 } // namespace lar_content
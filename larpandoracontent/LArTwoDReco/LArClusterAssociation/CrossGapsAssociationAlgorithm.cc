@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/CrossGapsAssociationAlgorithm.h"
 
@@ -58,15 +59,15 @@ void CrossGapsAssociationAlgorithm::GetListOfCleanClusters(const ClusterList *co
 
 void CrossGapsAssociationAlgorithm::PopulateClusterAssociationMap(const ClusterVector &clusterVector, ClusterAssociationMap &clusterAssociationMap) const
 {
-    TwoDSlidingFitResultMap slidingFitResultMap;
+    TwoDSlidingFitResultPtrMap slidingFitResultMap;
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
     for (const Cluster *const pCluster : clusterVector)
     {
         try
         {
-            (void)slidingFitResultMap.insert(
-                TwoDSlidingFitResultMap::value_type(pCluster, TwoDSlidingFitResult(pCluster, m_slidingFitWindow, slidingFitPitch)));
+            (void)slidingFitResultMap.insert(TwoDSlidingFitResultPtrMap::value_type(pCluster,
+                LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, m_slidingFitWindow, slidingFitPitch)));
         }
         catch (StatusCodeException &)
         {
@@ -77,7 +78,7 @@ void CrossGapsAssociationAlgorithm::PopulateClusterAssociationMap(const ClusterV
     for (ClusterVector::const_iterator iterI = clusterVector.begin(), iterIEnd = clusterVector.end(); iterI != iterIEnd; ++iterI)
     {
         const Cluster *const pInnerCluster = *iterI;
-        TwoDSlidingFitResultMap::const_iterator fitIterI = slidingFitResultMap.find(pInnerCluster);
+        TwoDSlidingFitResultPtrMap::const_iterator fitIterI = slidingFitResultMap.find(pInnerCluster);
 
         if (slidingFitResultMap.end() == fitIterI)
             continue;
@@ -89,12 +90,12 @@ void CrossGapsAssociationAlgorithm::PopulateClusterAssociationMap(const ClusterV
             if (pInnerCluster == pOuterCluster)
                 continue;
 
-            TwoDSlidingFitResultMap::const_iterator fitIterJ = slidingFitResultMap.find(pOuterCluster);
+            TwoDSlidingFitResultPtrMap::const_iterator fitIterJ = slidingFitResultMap.find(pOuterCluster);
 
             if (slidingFitResultMap.end() == fitIterJ)
                 continue;
 
-            if (!this->AreClustersAssociated(fitIterI->second, fitIterJ->second))
+            if (!this->AreClustersAssociated(*(fitIterI->second), *(fitIterJ->second)))
                 continue;
 
             clusterAssociationMap[pInnerCluster].m_forwardAssociations.insert(pOuterCluster);
@@ -201,6 +202,14 @@ bool CrossGapsAssociationAlgorithm::IsNearCluster(const CartesianVector &samplin
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode CrossGapsAssociationAlgorithm::Reset()
+{
+    LArSlidingFitCacheHelper::Reset(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CrossGapsAssociationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MinClusterHits", m_minClusterHits));
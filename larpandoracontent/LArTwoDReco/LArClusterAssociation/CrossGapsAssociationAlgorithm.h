@@ -65,6 +65,7 @@ private:
      */
     bool IsNearCluster(const pandora::CartesianVector &samplingPoint, const TwoDSlidingFitResult &targetFitResult) const;
 
+    pandora::StatusCode Reset();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     unsigned int m_minClusterHits;           ///< The minimum allowed number of hits in a clean cluster
@@ -56,7 +56,7 @@ void SimpleClusterMergingAlgorithm::PopulateClusterMergeMap(const ClusterVector
             if (pClusterI == pClusterJ)
                 continue;
 
-            if (this->IsAssociated(pClusterI, pClusterJ))
+            if (this->IsPairwiseAssociated(pClusterI, pClusterJ))
             {
                 clusterMergeMap[pClusterI].push_back(pClusterJ);
                 clusterMergeMap[pClusterJ].push_back(pClusterI);
@@ -67,7 +67,14 @@ void SimpleClusterMergingAlgorithm::PopulateClusterMergeMap(const ClusterVector
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool SimpleClusterMergingAlgorithm::IsAssociated(const Cluster *const pClusterI, const Cluster *const pClusterJ) const
+bool SimpleClusterMergingAlgorithm::HasPairwiseAssociations() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool SimpleClusterMergingAlgorithm::IsPairwiseAssociated(const Cluster *const pClusterI, const Cluster *const pClusterJ) const
 {
     if (LArClusterHelper::GetClosestDistance(pClusterI, pClusterJ) > m_maxClusterSeparation)
         return false;
@@ -38,6 +38,12 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
     ClusterVector sortedRemnantClusters(remnantClusters.begin(), remnantClusters.end());
     std::sort(sortedRemnantClusters.begin(), sortedRemnantClusters.end(), LArClusterHelper::SortByNHits);
 
+    // Gather the remnant cluster coordinates once, as each remnant cluster is compared with every pfo cluster
+    std::vector<CartesianPointVector> remnantCoordinateVectors(sortedRemnantClusters.size());
+
+    for (unsigned int iRemnant = 0; iRemnant < sortedRemnantClusters.size(); ++iRemnant)
+        LArClusterHelper::GetCoordinateVector(sortedRemnantClusters.at(iRemnant), remnantCoordinateVectors.at(iRemnant));
+
     for (const Cluster *const pPfoCluster : sortedPfoClusters)
     {
         const TwoDSlidingShowerFitResult fitResult(pPfoCluster, m_slidingFitWindow, slidingFitPitch, m_showerEdgeMultiplier);
@@ -46,9 +52,10 @@ void BoundedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
         const XSampling xSampling(fitResult.GetShowerFitResult());
         this->GetShowerPositionMap(fitResult, xSampling, showerPositionMap);
 
-        for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+        for (unsigned int iRemnant = 0; iRemnant < sortedRemnantClusters.size(); ++iRemnant)
         {
-            const float boundedFraction(this->GetBoundedFraction(pRemnantCluster, xSampling, showerPositionMap));
+            const Cluster *const pRemnantCluster(sortedRemnantClusters.at(iRemnant));
+            const float boundedFraction(this->GetBoundedFraction(remnantCoordinateVectors.at(iRemnant), xSampling, showerPositionMap));
 
             if (boundedFraction < m_minBoundedFraction)
                 continue;
@@ -94,40 +101,35 @@ void BoundedClusterMopUpAlgorithm::GetShowerPositionMap(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float BoundedClusterMopUpAlgorithm::GetBoundedFraction(
-    const Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const
+    const CartesianPointVector &coordinateVector, const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const
 {
-    if (((xSampling.m_maxX - xSampling.m_minX) < std::numeric_limits<float>::epsilon()) || (0 >= xSampling.m_nPoints) || (0 == pCluster->GetNCaloHits()))
+    if (((xSampling.m_maxX - xSampling.m_minX) < std::numeric_limits<float>::epsilon()) || (0 >= xSampling.m_nPoints) || coordinateVector.empty())
     {
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
     }
 
     unsigned int nMatchedHits(0);
-    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
 
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+    for (const CartesianVector &position : coordinateVector)
     {
-        for (CaloHitList::const_iterator hIter = iter->second->begin(), hIterEnd = iter->second->end(); hIter != hIterEnd; ++hIter)
+        const float x(position.GetX());
+        const float z(position.GetZ());
+
+        try
+        {
+            const int xBin(xSampling.GetBin(x));
+
+            ShowerPositionMap::const_iterator positionIter = showerPositionMap.find(xBin);
+
+            if ((showerPositionMap.end() != positionIter) && (z > positionIter->second.GetLowEdgeZ()) && (z < positionIter->second.GetHighEdgeZ()))
+                ++nMatchedHits;
+        }
+        catch (StatusCodeException &)
         {
-            const CaloHit *const pCaloHit = *hIter;
-            const float x(pCaloHit->GetPositionVector().GetX());
-            const float z(pCaloHit->GetPositionVector().GetZ());
-
-            try
-            {
-                const int xBin(xSampling.GetBin(x));
-
-                ShowerPositionMap::const_iterator positionIter = showerPositionMap.find(xBin);
-
-                if ((showerPositionMap.end() != positionIter) && (z > positionIter->second.GetLowEdgeZ()) && (z < positionIter->second.GetHighEdgeZ()))
-                    ++nMatchedHits;
-            }
-            catch (StatusCodeException &)
-            {
-            }
         }
     }
 
-    return (static_cast<float>(nMatchedHits) / static_cast<float>(pCluster->GetNCaloHits()));
+    return (static_cast<float>(nMatchedHits) / static_cast<float>(coordinateVector.size()));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -69,13 +69,14 @@ private:
     /**
      *  @brief  Get the fraction of hits in a cluster bounded by a specified shower position map
      *
-     *  @param  pCluster address of the cluster
+     *  @param  coordinateVector the coordinates of the cluster hits
      *  @param  xSampling the x sampling details
      *  @param  showerPositionMap the shower position map
      *
      *  @return the fraction of bounded hits
      */
-    float GetBoundedFraction(const pandora::Cluster *const pCluster, const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const;
+    float GetBoundedFraction(
+        const pandora::CartesianPointVector &coordinateVector, const XSampling &xSampling, const ShowerPositionMap &showerPositionMap) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterMopUp/ClusterMopUpBaseAlgorithm.h"
 
@@ -132,6 +133,8 @@ void ClusterMopUpBaseAlgorithm::MakeClusterMerges(const ClusterAssociationMap &c
         if (!pBestPfoCluster)
             continue;
 
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pBestPfoCluster);
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pRemnantCluster);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
             PandoraContentApi::MergeAndDeleteClusters(
                 *this, pBestPfoCluster, pRemnantCluster, this->GetListName(pBestPfoCluster), this->GetListName(pRemnantCluster)));
@@ -50,6 +50,12 @@ void ConeClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, con
     ClusterVector sortedRemnantClusters(remnantClusters.begin(), remnantClusters.end());
     std::sort(sortedRemnantClusters.begin(), sortedRemnantClusters.end(), LArClusterHelper::SortByNHits);
 
+    // Gather the remnant cluster coordinates once, as each remnant cluster is compared with every pfo cluster
+    std::vector<CartesianPointVector> remnantCoordinateVectors(sortedRemnantClusters.size());
+
+    for (unsigned int iRemnant = 0; iRemnant < sortedRemnantClusters.size(); ++iRemnant)
+        LArClusterHelper::GetCoordinateVector(sortedRemnantClusters.at(iRemnant), remnantCoordinateVectors.at(iRemnant));
+
     for (const Cluster *const pPfoCluster : sortedPfoClusters)
     {
         try
@@ -115,31 +121,28 @@ void ConeClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters, con
             }
 
             // Bounded fraction calculation
-            for (const Cluster *const pRemnantCluster : sortedRemnantClusters)
+            for (unsigned int iRemnant = 0; iRemnant < sortedRemnantClusters.size(); ++iRemnant)
             {
+                const Cluster *const pRemnantCluster(sortedRemnantClusters.at(iRemnant));
                 const unsigned int nHits(pRemnantCluster->GetNCaloHits());
 
                 unsigned int nMatchedHits(0);
-                const OrderedCaloHitList &orderedCaloHitList(pRemnantCluster->GetOrderedCaloHitList());
 
-                for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+                for (const CartesianVector &position : remnantCoordinateVectors.at(iRemnant))
                 {
-                    for (CaloHitList::const_iterator hIter = iter->second->begin(), hIterEnd = iter->second->end(); hIter != hIterEnd; ++hIter)
-                    {
-                        float rL(0.f), rT(0.f);
-                        showerFitResult.GetShowerFitResult().GetLocalPosition((*hIter)->GetPositionVector(), rL, rT);
+                    float rL(0.f), rT(0.f);
+                    showerFitResult.GetShowerFitResult().GetLocalPosition(position, rL, rT);
 
-                        if ((rL < minL) || (rL > maxL))
-                            continue;
+                    if ((rL < minL) || (rL > maxL))
+                        continue;
 
-                        const float rTP(minP.second + (rL - minP.first) * ((maxP.second - minP.second) / (maxP.first - minP.first)));
-                        const float rTN(minN.second + (rL - minN.first) * ((maxN.second - minN.second) / (maxN.first - minN.first)));
+                    const float rTP(minP.second + (rL - minP.first) * ((maxP.second - minP.second) / (maxP.first - minP.first)));
+                    const float rTN(minN.second + (rL - minN.first) * ((maxN.second - minN.second) / (maxN.first - minN.first)));
 
-                        if ((rT > rTP) || (rT < rTN))
-                            continue;
+                    if ((rT > rTP) || (rT < rTN))
+                        continue;
 
-                        ++nMatchedHits;
-                    }
+                    ++nMatchedHits;
                 }
 
                 const float boundedFraction((nHits > 0) ? static_cast<float>(nMatchedHits) / static_cast<float>(nHits) : 0.f);
@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterMopUp/IsolatedClusterMopUpAlgorithm.h"
 
@@ -46,6 +47,8 @@ void IsolatedClusterMopUpAlgorithm::ClusterMopUp(const ClusterList &pfoClusters,
 
     for (const CaloHit *pCaloHit : sortedCaloHitList)
     {
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), caloHitToClusterMap.at(pCaloHit));
+
         if (m_addHitsAsIsolated)
         {
             PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::AddIsolatedToCluster(*this, caloHitToClusterMap.at(pCaloHit), pCaloHit));
@@ -67,6 +70,7 @@ void IsolatedClusterMopUpAlgorithm::DissolveClustersToHits(const ClusterList &cl
         {
             const std::string listNameR(this->GetListName(pRemnantCluster));
             pRemnantCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pRemnantCluster);
             PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Delete(*this, pRemnantCluster, listNameR));
         }
     }
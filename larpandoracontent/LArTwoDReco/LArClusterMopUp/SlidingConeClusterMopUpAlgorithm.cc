@@ -11,6 +11,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingConeFitResult.h"
 
@@ -222,6 +223,8 @@ void SlidingConeClusterMopUpAlgorithm::MakeClusterMerges(const ClusterToPfoMap &
 
         if (pParentCluster)
         {
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pParentCluster);
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pDaughterCluster);
             PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
                 PandoraContentApi::MergeAndDeleteClusters(
                     *this, pParentCluster, pDaughterCluster, this->GetListName(pParentCluster), this->GetListName(pDaughterCluster)));
@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/ClusterSplittingAlgorithm.h"
 
@@ -101,6 +102,7 @@ StatusCode ClusterSplittingAlgorithm::SplitCluster(const Cluster *const pCluster
     clusterSplittingList.push_back(pSecondCluster);
 
     // End cluster fragmentation operations
+    LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pCluster);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndFragmentation(*this, clusterListToSaveName, clusterListToDeleteName));
 
     return STATUS_CODE_SUCCESS;
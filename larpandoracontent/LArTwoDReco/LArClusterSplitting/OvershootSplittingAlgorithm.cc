@@ -49,7 +49,8 @@ void OvershootSplittingAlgorithm::GetListOfCleanClusters(const ClusterList *cons
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void OvershootSplittingAlgorithm::FindBestSplitPositions(const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterPositionMap &clusterSplittingMap) const
+void OvershootSplittingAlgorithm::FindBestSplitPositions(
+    const TwoDSlidingFitResultPtrMap &slidingFitResultMap, ClusterPositionMap &clusterSplittingMap) const
 {
     // Use sliding fit results to build a list of intersection points
     ClusterPositionMap clusterIntersectionMap;
@@ -65,7 +66,8 @@ void OvershootSplittingAlgorithm::FindBestSplitPositions(const TwoDSlidingFitRes
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void OvershootSplittingAlgorithm::BuildIntersectionMap(const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterPositionMap &clusterIntersectionMap) const
+void OvershootSplittingAlgorithm::BuildIntersectionMap(
+    const TwoDSlidingFitResultPtrMap &slidingFitResultMap, ClusterPositionMap &clusterIntersectionMap) const
 {
     ClusterList clusterList;
     for (const auto &mapEntry : slidingFitResultMap)
@@ -74,14 +76,14 @@ void OvershootSplittingAlgorithm::BuildIntersectionMap(const TwoDSlidingFitResul
 
     for (const Cluster *const pCluster1 : clusterList)
     {
-        const TwoDSlidingFitResult &slidingFitResult1(slidingFitResultMap.at(pCluster1));
+        const TwoDSlidingFitResult &slidingFitResult1(*(slidingFitResultMap.at(pCluster1)));
 
         for (const Cluster *const pCluster2 : clusterList)
         {
             if (pCluster1 == pCluster2)
                 continue;
 
-            const TwoDSlidingFitResult &slidingFitResult2(slidingFitResultMap.at(pCluster2));
+            const TwoDSlidingFitResult &slidingFitResult2(*(slidingFitResultMap.at(pCluster2)));
 
             try
             {
@@ -172,7 +174,7 @@ void OvershootSplittingAlgorithm::BuildIntersectionMap(const TwoDSlidingFitResul
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void OvershootSplittingAlgorithm::BuildSortedIntersectionMap(const TwoDSlidingFitResultMap &slidingFitResultMap,
+void OvershootSplittingAlgorithm::BuildSortedIntersectionMap(const TwoDSlidingFitResultPtrMap &slidingFitResultMap,
     const ClusterPositionMap &clusterIntersectionMap, ClusterPositionMap &sortedIntersectionMap) const
 {
     ClusterList clusterList;
@@ -187,11 +189,11 @@ void OvershootSplittingAlgorithm::BuildSortedIntersectionMap(const TwoDSlidingFi
         if (inputPositionVector.empty())
             continue;
 
-        TwoDSlidingFitResultMap::const_iterator sIter = slidingFitResultMap.find(pCluster);
+        TwoDSlidingFitResultPtrMap::const_iterator sIter = slidingFitResultMap.find(pCluster);
         if (slidingFitResultMap.end() == sIter)
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        const TwoDSlidingFitResult &slidingFitResult = sIter->second;
+        const TwoDSlidingFitResult &slidingFitResult = *(sIter->second);
 
         MyTrajectoryPointList trajectoryPointList;
         for (CartesianPointVector::const_iterator pIter = inputPositionVector.begin(), pIterEnd = inputPositionVector.end(); pIter != pIterEnd; ++pIter)
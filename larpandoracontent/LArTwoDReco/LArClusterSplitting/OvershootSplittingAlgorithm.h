@@ -26,7 +26,7 @@ public:
 
 private:
     void GetListOfCleanClusters(const pandora::ClusterList *const pClusterList, pandora::ClusterVector &clusterVector) const;
-    void FindBestSplitPositions(const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterPositionMap &clusterSplittingMap) const;
+    void FindBestSplitPositions(const TwoDSlidingFitResultPtrMap &slidingFitResultMap, ClusterPositionMap &clusterSplittingMap) const;
 
     typedef std::pair<float, pandora::CartesianVector> MyTrajectoryPoint;
     typedef std::vector<MyTrajectoryPoint> MyTrajectoryPointList;
@@ -37,7 +37,7 @@ private:
      *  @param  slidingFitResultMap the sliding fit result map
      *  @param  clusterIntersectionMap the map of cluster intersection points
      */
-    void BuildIntersectionMap(const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterPositionMap &clusterIntersectionMap) const;
+    void BuildIntersectionMap(const TwoDSlidingFitResultPtrMap &slidingFitResultMap, ClusterPositionMap &clusterIntersectionMap) const;
 
     /**
      *  @brief  Use intersection points to decide on splitting points
@@ -46,7 +46,7 @@ private:
      *  @param  clusterIntersectionMap the input map of cluster intersection points
      *  @param  sortedIntersectionMap the output map of sorted cluster intersection points
      */
-    void BuildSortedIntersectionMap(const TwoDSlidingFitResultMap &slidingFitResultMap, const ClusterPositionMap &clusterIntersectionMap,
+    void BuildSortedIntersectionMap(const TwoDSlidingFitResultPtrMap &slidingFitResultMap, const ClusterPositionMap &clusterIntersectionMap,
         ClusterPositionMap &sortedIntersectionMap) const;
 
     /**
@@ -24,11 +24,12 @@ TrackConsolidationAlgorithm::TrackConsolidationAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackConsolidationAlgorithm::GetReclusteredHits(const TwoDSlidingFitResultList &slidingFitResultListI,
+void TrackConsolidationAlgorithm::GetReclusteredHits(const TwoDSlidingFitResultPtrList &slidingFitResultListI,
     const ClusterVector &showerClustersJ, ClusterToHitMap &caloHitsToAddI, ClusterToHitMap &caloHitsToRemoveJ) const
 {
-    for (const TwoDSlidingFitResult &slidingFitResultI : slidingFitResultListI)
+    for (const TwoDSlidingFitResultPtr &pSlidingFitResultI : slidingFitResultListI)
     {
+        const TwoDSlidingFitResult &slidingFitResultI(*pSlidingFitResultI);
         const Cluster *const pClusterI = slidingFitResultI.GetCluster();
         const float thisLengthSquaredI(LArClusterHelper::GetLengthSquared(pClusterI));
 
@@ -37,7 +37,7 @@ private:
      *  @param caloHitsToAdd   the output map of hits to be added to clusters
      *  @param caloHitsToRemove   the output map of hits to be removed from clusters
      */
-    void GetReclusteredHits(const TwoDSlidingFitResultList &slidingFitResultList, const pandora::ClusterVector &showerClusters,
+    void GetReclusteredHits(const TwoDSlidingFitResultPtrList &slidingFitResultList, const pandora::ClusterVector &showerClusters,
         ClusterToHitMap &caloHitsToAdd, ClusterToHitMap &caloHitsToRemove) const;
 
     /**
@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/TwoDSlidingFitConsolidationAlgorithm.h"
 
@@ -27,6 +28,14 @@ TwoDSlidingFitConsolidationAlgorithm::TwoDSlidingFitConsolidationAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TwoDSlidingFitConsolidationAlgorithm::Reset()
+{
+    LArSlidingFitCacheHelper::Reset(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDSlidingFitConsolidationAlgorithm::Run()
 {
     const ClusterList *pClusterList = NULL;
@@ -37,7 +46,7 @@ StatusCode TwoDSlidingFitConsolidationAlgorithm::Run()
     this->SortInputClusters(pClusterList, trackClusters, showerClusters);
 
     // Build sliding linear fits from track clusters
-    TwoDSlidingFitResultList slidingFitResultList;
+    TwoDSlidingFitResultPtrList slidingFitResultList;
     this->BuildSlidingLinearFits(trackClusters, slidingFitResultList);
 
     // Recluster the hits
@@ -77,7 +86,8 @@ void TwoDSlidingFitConsolidationAlgorithm::SortInputClusters(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TwoDSlidingFitConsolidationAlgorithm::BuildSlidingLinearFits(const ClusterVector &trackClusters, TwoDSlidingFitResultList &slidingFitResultList) const
+void TwoDSlidingFitConsolidationAlgorithm::BuildSlidingLinearFits(
+    const ClusterVector &trackClusters, TwoDSlidingFitResultPtrList &slidingFitResultList) const
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
@@ -85,8 +95,8 @@ void TwoDSlidingFitConsolidationAlgorithm::BuildSlidingLinearFits(const ClusterV
     {
         try
         {
-            const TwoDSlidingFitResult slidingFitResult(*iter, m_halfWindowLayers, slidingFitPitch);
-            slidingFitResultList.push_back(slidingFitResult);
+            slidingFitResultList.push_back(
+                LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), *iter, m_halfWindowLayers, slidingFitPitch));
         }
         catch (StatusCodeException &statusCodeException)
         {
@@ -128,10 +138,13 @@ StatusCode TwoDSlidingFitConsolidationAlgorithm::RemoveHitsFromClusters(const Cl
         {
             // ATTN clustersToContract and unavailable clusters now contain dangling pointers
             unavailableClusters.insert(pCluster);
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pCluster);
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Delete<Cluster>(*this, pCluster));
             continue;
         }
 
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pCluster);
+
         for (const CaloHit *const pCaloHit : caloHitListToRemove)
         {
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::RemoveFromCluster(*this, pCluster, pCaloHit));
@@ -167,6 +180,8 @@ StatusCode TwoDSlidingFitConsolidationAlgorithm::AddHitsToClusters(const Cluster
 
         unavailableClusters.insert(pCluster);
 
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pCluster);
+
         for (const CaloHit *const pCaloHit : caloHitList)
         {
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::AddToCluster(*this, pCluster, pCaloHit));
@@ -202,6 +217,7 @@ StatusCode TwoDSlidingFitConsolidationAlgorithm::RebuildClusters(const ClusterTo
 
         std::string currentClusterListName;
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentListName<Cluster>(*this, currentClusterListName));
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pClusterToDelete);
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Delete<Cluster>(*this, pClusterToDelete));
 
         const ClusterList *pClusterList = NULL;
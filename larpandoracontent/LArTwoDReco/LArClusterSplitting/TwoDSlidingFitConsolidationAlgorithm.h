@@ -29,6 +29,7 @@ public:
     TwoDSlidingFitConsolidationAlgorithm();
 
 protected:
+    pandora::StatusCode Reset();
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -42,7 +43,7 @@ protected:
      *  @param caloHitsToAdd   the output map of hits to be added to clusters
      *  @param caloHitsToRemove   the output map of hits to be removed from clusters
      */
-    virtual void GetReclusteredHits(const TwoDSlidingFitResultList &slidingFitResultList, const pandora::ClusterVector &showerClusters,
+    virtual void GetReclusteredHits(const TwoDSlidingFitResultPtrList &slidingFitResultList, const pandora::ClusterVector &showerClusters,
         ClusterToHitMap &caloHitsToAdd, ClusterToHitMap &caloHitsToRemove) const = 0;
 
 private:
@@ -62,7 +63,7 @@ private:
      *  @param trackClusters  the input vector of track-like clusters
      *  @param slidingFitResultList  the output list of sliding linear fits
      */
-    void BuildSlidingLinearFits(const pandora::ClusterVector &trackClusters, TwoDSlidingFitResultList &slidingFitResultList) const;
+    void BuildSlidingLinearFits(const pandora::ClusterVector &trackClusters, TwoDSlidingFitResultPtrList &slidingFitResultList) const;
 
     /**
      *  @brief Remove hits from clusters
@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/TwoDSlidingFitMultiSplitAlgorithm.h"
 
@@ -24,6 +25,14 @@ TwoDSlidingFitMultiSplitAlgorithm::TwoDSlidingFitMultiSplitAlgorithm() : m_slidi
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TwoDSlidingFitMultiSplitAlgorithm::Reset()
+{
+    LArSlidingFitCacheHelper::Reset(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDSlidingFitMultiSplitAlgorithm::Run()
 {
     std::string originalListName;
@@ -51,7 +60,7 @@ StatusCode TwoDSlidingFitMultiSplitAlgorithm::Run()
     this->GetListOfCleanClusters(pClusterList, clusterVector);
 
     // Build a set of sliding fit results for clean clusters
-    TwoDSlidingFitResultMap slidingFitResultMap;
+    TwoDSlidingFitResultPtrMap slidingFitResultMap;
     this->BuildSlidingFitResultMap(clusterVector, m_slidingFitHalfWindow, slidingFitResultMap);
 
     // Find best split positions for each cluster
@@ -70,7 +79,7 @@ StatusCode TwoDSlidingFitMultiSplitAlgorithm::Run()
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void TwoDSlidingFitMultiSplitAlgorithm::BuildSlidingFitResultMap(
-    const ClusterVector &clusterVector, const unsigned int halfWindowLayers, TwoDSlidingFitResultMap &slidingFitResultMap) const
+    const ClusterVector &clusterVector, const unsigned int halfWindowLayers, TwoDSlidingFitResultPtrMap &slidingFitResultMap) const
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
@@ -80,9 +89,10 @@ void TwoDSlidingFitMultiSplitAlgorithm::BuildSlidingFitResultMap(
         {
             try
             {
-                const TwoDSlidingFitResult slidingFitResult(*iter, halfWindowLayers, slidingFitPitch);
+                const TwoDSlidingFitResultPtr pSlidingFitResult(
+                    LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), *iter, halfWindowLayers, slidingFitPitch));
 
-                if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, slidingFitResult)).second)
+                if (!slidingFitResultMap.insert(TwoDSlidingFitResultPtrMap::value_type(*iter, pSlidingFitResult)).second)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
             }
             catch (StatusCodeException &statusCodeException)
@@ -97,7 +107,7 @@ void TwoDSlidingFitMultiSplitAlgorithm::BuildSlidingFitResultMap(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode TwoDSlidingFitMultiSplitAlgorithm::SplitClusters(
-    const TwoDSlidingFitResultMap &slidingFitResultMap, const ClusterPositionMap &clusterSplittingMap) const
+    const TwoDSlidingFitResultPtrMap &slidingFitResultMap, const ClusterPositionMap &clusterSplittingMap) const
 {
     ClusterList clusterList;
     for (const auto &mapEntry : clusterSplittingMap)
@@ -111,11 +121,11 @@ StatusCode TwoDSlidingFitMultiSplitAlgorithm::SplitClusters(
         if (splitPositionVector.empty())
             continue;
 
-        TwoDSlidingFitResultMap::const_iterator sIter = slidingFitResultMap.find(pCluster);
+        TwoDSlidingFitResultPtrMap::const_iterator sIter = slidingFitResultMap.find(pCluster);
         if (slidingFitResultMap.end() == sIter)
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        const TwoDSlidingFitResult &slidingFitResult = sIter->second;
+        const TwoDSlidingFitResult &slidingFitResult = *(sIter->second);
 
         StatusCode statusCode(this->SplitCluster(slidingFitResult, splitPositionVector));
 
@@ -199,6 +209,7 @@ StatusCode TwoDSlidingFitMultiSplitAlgorithm::SplitCluster(const TwoDSlidingFitR
     }
 
     // End cluster fragmentation operations
+    LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pCluster);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndFragmentation(*this, clusterListToSave, clusterListToDelete));
 
     return STATUS_CODE_SUCCESS;
@@ -43,11 +43,12 @@ protected:
      *  @param  slidingFitResultMap mapping from clusters to sliding fit results
      *  @param  clusterSplittingMap mapping from clusters to split positions
      */
-    virtual void FindBestSplitPositions(const TwoDSlidingFitResultMap &slidingFitResultMap, ClusterPositionMap &clusterSplittingMap) const = 0;
+    virtual void FindBestSplitPositions(const TwoDSlidingFitResultPtrMap &slidingFitResultMap, ClusterPositionMap &clusterSplittingMap) const = 0;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
 private:
+    pandora::StatusCode Reset();
     pandora::StatusCode Run();
 
     /**
@@ -58,7 +59,7 @@ private:
      *  @param  slidingFitResultMap the sliding fit result map
      */
     void BuildSlidingFitResultMap(const pandora::ClusterVector &clusterVector, const unsigned int halfWindowLayers,
-        TwoDSlidingFitResultMap &slidingFitResultMap) const;
+        TwoDSlidingFitResultPtrMap &slidingFitResultMap) const;
 
     /**
      *  @brief  Split clusters
@@ -66,7 +67,7 @@ private:
      *  @param  slidingFitResultMap mapping from clusters to sliding fit results
      *  @param  clusterSplittingMap mapping from clusters to split positions
      */
-    pandora::StatusCode SplitClusters(const TwoDSlidingFitResultMap &slidingFitResultMap, const ClusterPositionMap &clusterSplittingMap) const;
+    pandora::StatusCode SplitClusters(const TwoDSlidingFitResultPtrMap &slidingFitResultMap, const ClusterPositionMap &clusterSplittingMap) const;
 
     /**
      *  @brief  Split cluster
@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/TwoDSlidingFitSplittingAndSplicingAlgorithm.h"
 
@@ -29,12 +30,20 @@ TwoDSlidingFitSplittingAndSplicingAlgorithm::TwoDSlidingFitSplittingAndSplicingA
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TwoDSlidingFitSplittingAndSplicingAlgorithm::Reset()
+{
+    LArSlidingFitCacheHelper::Reset(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDSlidingFitSplittingAndSplicingAlgorithm::Run()
 {
     const ClusterList *pClusterList = NULL;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pClusterList));
 
-    TwoDSlidingFitResultMap branchSlidingFitResultMap, replacementSlidingFitResultMap;
+    TwoDSlidingFitResultPtrMap branchSlidingFitResultMap, replacementSlidingFitResultMap;
 
     unsigned int nIterations(0);
 
@@ -92,7 +101,7 @@ void TwoDSlidingFitSplittingAndSplicingAlgorithm::GetListOfCleanClusters(const C
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void TwoDSlidingFitSplittingAndSplicingAlgorithm::BuildSlidingFitResultMap(
-    const ClusterVector &clusterVector, const unsigned int halfWindowLayers, TwoDSlidingFitResultMap &slidingFitResultMap) const
+    const ClusterVector &clusterVector, const unsigned int halfWindowLayers, TwoDSlidingFitResultPtrMap &slidingFitResultMap) const
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
@@ -102,9 +111,10 @@ void TwoDSlidingFitSplittingAndSplicingAlgorithm::BuildSlidingFitResultMap(
         {
             try
             {
-                const TwoDSlidingFitResult slidingFitResult(*iter, halfWindowLayers, slidingFitPitch);
+                const TwoDSlidingFitResultPtr pSlidingFitResult(
+                    LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), *iter, halfWindowLayers, slidingFitPitch));
 
-                if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, slidingFitResult)).second)
+                if (!slidingFitResultMap.insert(TwoDSlidingFitResultPtrMap::value_type(*iter, pSlidingFitResult)).second)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
             }
             catch (StatusCodeException &statusCodeException)
@@ -119,7 +129,7 @@ void TwoDSlidingFitSplittingAndSplicingAlgorithm::BuildSlidingFitResultMap(
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void TwoDSlidingFitSplittingAndSplicingAlgorithm::BuildClusterExtensionList(const ClusterVector &clusterVector,
-    const TwoDSlidingFitResultMap &branchSlidingFitResultMap, const TwoDSlidingFitResultMap &replacementSlidingFitResultMap,
+    const TwoDSlidingFitResultPtrMap &branchSlidingFitResultMap, const TwoDSlidingFitResultPtrMap &replacementSlidingFitResultMap,
     ClusterExtensionList &clusterExtensionList) const
 {
     // Loop over each possible pair of clusters
@@ -135,11 +145,11 @@ void TwoDSlidingFitSplittingAndSplicingAlgorithm::BuildClusterExtensionList(cons
                 continue;
 
             // Get the branch and replacement sliding fits for this pair of clusters
-            TwoDSlidingFitResultMap::const_iterator iterBranchI = branchSlidingFitResultMap.find(*iterI);
-            TwoDSlidingFitResultMap::const_iterator iterBranchJ = branchSlidingFitResultMap.find(*iterJ);
+            TwoDSlidingFitResultPtrMap::const_iterator iterBranchI = branchSlidingFitResultMap.find(*iterI);
+            TwoDSlidingFitResultPtrMap::const_iterator iterBranchJ = branchSlidingFitResultMap.find(*iterJ);
 
-            TwoDSlidingFitResultMap::const_iterator iterReplacementI = replacementSlidingFitResultMap.find(*iterI);
-            TwoDSlidingFitResultMap::const_iterator iterReplacementJ = replacementSlidingFitResultMap.find(*iterJ);
+            TwoDSlidingFitResultPtrMap::const_iterator iterReplacementI = replacementSlidingFitResultMap.find(*iterI);
+            TwoDSlidingFitResultPtrMap::const_iterator iterReplacementJ = replacementSlidingFitResultMap.find(*iterJ);
 
             if (branchSlidingFitResultMap.end() == iterBranchI || branchSlidingFitResultMap.end() == iterBranchJ ||
                 replacementSlidingFitResultMap.end() == iterReplacementI || replacementSlidingFitResultMap.end() == iterReplacementJ)
@@ -148,11 +158,11 @@ void TwoDSlidingFitSplittingAndSplicingAlgorithm::BuildClusterExtensionList(cons
                 continue;
             }
 
-            const TwoDSlidingFitResult &branchSlidingFitI(iterBranchI->second);
-            const TwoDSlidingFitResult &branchSlidingFitJ(iterBranchJ->second);
+            const TwoDSlidingFitResult &branchSlidingFitI(*(iterBranchI->second));
+            const TwoDSlidingFitResult &branchSlidingFitJ(*(iterBranchJ->second));
 
-            const TwoDSlidingFitResult &replacementSlidingFitI(iterReplacementI->second);
-            const TwoDSlidingFitResult &replacementSlidingFitJ(iterReplacementJ->second);
+            const TwoDSlidingFitResult &replacementSlidingFitI(*(iterReplacementI->second));
+            const TwoDSlidingFitResult &replacementSlidingFitJ(*(iterReplacementJ->second));
 
             // Search for a split in clusterI
             float branchChisqI(0.f);
@@ -223,7 +233,7 @@ void TwoDSlidingFitSplittingAndSplicingAlgorithm::BuildClusterExtensionList(cons
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void TwoDSlidingFitSplittingAndSplicingAlgorithm::PruneClusterExtensionList(const ClusterExtensionList &inputList,
-    const TwoDSlidingFitResultMap &branchMap, const TwoDSlidingFitResultMap &replacementMap, ClusterExtensionList &outputList) const
+    const TwoDSlidingFitResultPtrMap &branchMap, const TwoDSlidingFitResultPtrMap &replacementMap, ClusterExtensionList &outputList) const
 {
     ClusterList branchList;
     for (const auto &mapEntry : branchMap)
@@ -248,7 +258,7 @@ void TwoDSlidingFitSplittingAndSplicingAlgorithm::PruneClusterExtensionList(cons
         // Veto the merge if another cluster is closer to the replacement vertex
         for (const Cluster *const pBranchCluster : branchList)
         {
-            const TwoDSlidingFitResult &slidingFit(branchMap.at(pBranchCluster));
+            const TwoDSlidingFitResult &slidingFit(*(branchMap.at(pBranchCluster)));
 
             if (slidingFit.GetCluster() == thisSplit.GetReplacementCluster() || slidingFit.GetCluster() == thisSplit.GetBranchCluster())
                 continue;
@@ -266,7 +276,7 @@ void TwoDSlidingFitSplittingAndSplicingAlgorithm::PruneClusterExtensionList(cons
         // Veto the merge if another cluster is closer to the branch vertex
         for (const Cluster *const pReplacementCluster : replacementList)
         {
-            const TwoDSlidingFitResult &slidingFit(replacementMap.at(pReplacementCluster));
+            const TwoDSlidingFitResult &slidingFit(*(replacementMap.at(pReplacementCluster)));
 
             if (slidingFit.GetCluster() == thisSplit.GetReplacementCluster() || slidingFit.GetCluster() == thisSplit.GetBranchCluster())
                 continue;
@@ -347,7 +357,7 @@ void TwoDSlidingFitSplittingAndSplicingAlgorithm::SplitBranchCluster(const Clust
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 StatusCode TwoDSlidingFitSplittingAndSplicingAlgorithm::RunSplitAndExtension(
-    const ClusterExtensionList &splitList, TwoDSlidingFitResultMap &branchResultMap, TwoDSlidingFitResultMap &replacementResultMap) const
+    const ClusterExtensionList &splitList, TwoDSlidingFitResultPtrMap &branchResultMap, TwoDSlidingFitResultPtrMap &replacementResultMap) const
 {
     bool foundSplit(false);
 
@@ -360,11 +370,11 @@ StatusCode TwoDSlidingFitSplittingAndSplicingAlgorithm::RunSplitAndExtension(
         const CartesianVector &branchSplitPosition = thisSplit.GetBranchVertex();
         const CartesianVector &branchSplitDirection = thisSplit.GetBranchDirection();
 
-        TwoDSlidingFitResultMap::iterator iterBranch1 = branchResultMap.find(pBranchCluster);
-        TwoDSlidingFitResultMap::iterator iterBranch2 = branchResultMap.find(pReplacementCluster);
+        TwoDSlidingFitResultPtrMap::iterator iterBranch1 = branchResultMap.find(pBranchCluster);
+        TwoDSlidingFitResultPtrMap::iterator iterBranch2 = branchResultMap.find(pReplacementCluster);
 
-        TwoDSlidingFitResultMap::iterator iterReplacement1 = replacementResultMap.find(pBranchCluster);
-        TwoDSlidingFitResultMap::iterator iterReplacement2 = replacementResultMap.find(pReplacementCluster);
+        TwoDSlidingFitResultPtrMap::iterator iterReplacement1 = replacementResultMap.find(pBranchCluster);
+        TwoDSlidingFitResultPtrMap::iterator iterReplacement2 = replacementResultMap.find(pReplacementCluster);
 
         if (branchResultMap.end() == iterBranch1 || branchResultMap.end() == iterBranch2 ||
             replacementResultMap.end() == iterReplacement1 || replacementResultMap.end() == iterReplacement2)
@@ -412,6 +422,7 @@ StatusCode TwoDSlidingFitSplittingAndSplicingAlgorithm::ReplaceBranch(const Clus
     const Cluster *pPrincipalCluster(NULL), *pResidualCluster(NULL);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, principalParameters, pPrincipalCluster));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, residualParameters, pResidualCluster));
+    LArSlidingFitCacheHelper::InvalidateClusters(this->GetPandora(), clusterList);
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndFragmentation(*this, clusterListToSaveName, clusterListToDeleteName));
 
     return STATUS_CODE_SUCCESS;
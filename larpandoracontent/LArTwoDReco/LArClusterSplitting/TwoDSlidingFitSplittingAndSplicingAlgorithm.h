@@ -27,6 +27,7 @@ public:
     TwoDSlidingFitSplittingAndSplicingAlgorithm();
 
 protected:
+    virtual pandora::StatusCode Reset();
     virtual pandora::StatusCode Run();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -114,7 +115,7 @@ private:
      *  @param  slidingFitResultMap the output sliding fit result map
      */
     void BuildSlidingFitResultMap(const pandora::ClusterVector &clusterVector, const unsigned int halfWindowLayers,
-        TwoDSlidingFitResultMap &slidingFitResultMap) const;
+        TwoDSlidingFitResultPtrMap &slidingFitResultMap) const;
 
     /**
      *  @brief  Build a list of candidate splits
@@ -124,8 +125,8 @@ private:
      *  @param  replacementResultMap the sliding fit result map for replacement clusters
      *  @param  clusterExtensionList the output list of candidate splits
      */
-    void BuildClusterExtensionList(const pandora::ClusterVector &clusterVector, const TwoDSlidingFitResultMap &branchResultMap,
-        const TwoDSlidingFitResultMap &replacementResultMap, ClusterExtensionList &clusterExtensionList) const;
+    void BuildClusterExtensionList(const pandora::ClusterVector &clusterVector, const TwoDSlidingFitResultPtrMap &branchResultMap,
+        const TwoDSlidingFitResultPtrMap &replacementResultMap, ClusterExtensionList &clusterExtensionList) const;
 
     /**
      *  @brief  Finalize the list of candidate splits
@@ -135,8 +136,8 @@ private:
      *  @param  replacementResultMap the sliding fit result map for replacement clusters
      *  @param  outputList the output list of definite splits
      */
-    void PruneClusterExtensionList(const ClusterExtensionList &inputList, const TwoDSlidingFitResultMap &branchResultMap,
-        const TwoDSlidingFitResultMap &replacementResultMap, ClusterExtensionList &outputList) const;
+    void PruneClusterExtensionList(const ClusterExtensionList &inputList, const TwoDSlidingFitResultPtrMap &branchResultMap,
+        const TwoDSlidingFitResultPtrMap &replacementResultMap, ClusterExtensionList &outputList) const;
 
     /**
      *  @brief  Calculate RMS deviation of branch hits relative to the split direction
@@ -167,8 +168,8 @@ private:
      *  @param  branchResultMap the sliding fit result map for branch clusters
      *  @param  replacementResultMap the sliding fit result map for replacement clusters
      */
-    pandora::StatusCode RunSplitAndExtension(const ClusterExtensionList &splitList, TwoDSlidingFitResultMap &branchResultMap,
-        TwoDSlidingFitResultMap &replacementResultMap) const;
+    pandora::StatusCode RunSplitAndExtension(const ClusterExtensionList &splitList, TwoDSlidingFitResultPtrMap &branchResultMap,
+        TwoDSlidingFitResultPtrMap &replacementResultMap) const;
 
     /**
      *  @brief  Remove a branch from a cluster and replace it with a second cluster
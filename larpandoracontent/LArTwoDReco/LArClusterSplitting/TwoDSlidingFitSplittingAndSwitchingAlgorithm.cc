@@ -10,6 +10,7 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/TwoDSlidingFitSplittingAndSwitchingAlgorithm.h"
 
@@ -26,6 +27,14 @@ TwoDSlidingFitSplittingAndSwitchingAlgorithm::TwoDSlidingFitSplittingAndSwitchin
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TwoDSlidingFitSplittingAndSwitchingAlgorithm::Reset()
+{
+    LArSlidingFitCacheHelper::Reset(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDSlidingFitSplittingAndSwitchingAlgorithm::Run()
 {
     const ClusterList *pClusterList = NULL;
@@ -36,7 +45,7 @@ StatusCode TwoDSlidingFitSplittingAndSwitchingAlgorithm::Run()
     this->GetListOfCleanClusters(pClusterList, clusterVector);
 
     // Calculate sliding fit results for clean clusters
-    TwoDSlidingFitResultMap slidingFitResultMap;
+    TwoDSlidingFitResultPtrMap slidingFitResultMap;
     this->BuildSlidingFitResultMap(clusterVector, slidingFitResultMap);
 
     // May choose to cache information here, for subsequent expensive calculations
@@ -48,24 +57,24 @@ StatusCode TwoDSlidingFitSplittingAndSwitchingAlgorithm::Run()
         if (NULL == *iter1)
             continue;
 
-        TwoDSlidingFitResultMap::iterator sIter1 = slidingFitResultMap.find(*iter1);
+        TwoDSlidingFitResultPtrMap::iterator sIter1 = slidingFitResultMap.find(*iter1);
 
         if (slidingFitResultMap.end() == sIter1)
             continue;
 
-        const TwoDSlidingFitResult &slidingFitResult1(sIter1->second);
+        const TwoDSlidingFitResult &slidingFitResult1(*(sIter1->second));
 
         for (ClusterVector::iterator iter2 = iter1, iterEnd2 = iterEnd1; iter2 != iterEnd2; ++iter2)
         {
             if (NULL == *iter2)
                 continue;
 
-            TwoDSlidingFitResultMap::iterator sIter2 = slidingFitResultMap.find(*iter2);
+            TwoDSlidingFitResultPtrMap::iterator sIter2 = slidingFitResultMap.find(*iter2);
 
             if (slidingFitResultMap.end() == sIter2)
                 continue;
 
-            const TwoDSlidingFitResult &slidingFitResult2(sIter2->second);
+            const TwoDSlidingFitResult &slidingFitResult2(*(sIter2->second));
 
             if (slidingFitResult1.GetCluster() == slidingFitResult2.GetCluster())
                 continue;
@@ -130,7 +139,7 @@ void TwoDSlidingFitSplittingAndSwitchingAlgorithm::GetListOfCleanClusters(const
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void TwoDSlidingFitSplittingAndSwitchingAlgorithm::BuildSlidingFitResultMap(
-    const ClusterVector &clusterVector, TwoDSlidingFitResultMap &slidingFitResultMap) const
+    const ClusterVector &clusterVector, TwoDSlidingFitResultPtrMap &slidingFitResultMap) const
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
@@ -140,9 +149,10 @@ void TwoDSlidingFitSplittingAndSwitchingAlgorithm::BuildSlidingFitResultMap(
         {
             try
             {
-                const TwoDSlidingFitResult slidingFitResult(*iter, m_halfWindowLayers, slidingFitPitch);
+                const TwoDSlidingFitResultPtr pSlidingFitResult(
+                    LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), *iter, m_halfWindowLayers, slidingFitPitch));
 
-                if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, slidingFitResult)).second)
+                if (!slidingFitResultMap.insert(TwoDSlidingFitResultPtrMap::value_type(*iter, pSlidingFitResult)).second)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
             }
             catch (StatusCodeException &statusCodeException)
@@ -206,6 +216,7 @@ StatusCode TwoDSlidingFitSplittingAndSwitchingAlgorithm::ReplaceClusters(const C
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, secondParameters, pSecondCluster));
 
     // End cluster fragmentation operations
+    LArSlidingFitCacheHelper::InvalidateClusters(this->GetPandora(), clusterList);
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndFragmentation(*this, clusterListToSaveName, clusterListToDeleteName));
 
     return STATUS_CODE_SUCCESS;
@@ -27,6 +27,7 @@ public:
     TwoDSlidingFitSplittingAndSwitchingAlgorithm();
 
 protected:
+    virtual pandora::StatusCode Reset();
     virtual pandora::StatusCode Run();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -69,7 +70,7 @@ private:
      *  @param  clusterVector the input cluster vector
      *  @param  slidingFitResultMap the output sliding fit result map
      */
-    void BuildSlidingFitResultMap(const pandora::ClusterVector &clusterVector, TwoDSlidingFitResultMap &slidingFitResultMap) const;
+    void BuildSlidingFitResultMap(const pandora::ClusterVector &clusterVector, TwoDSlidingFitResultPtrMap &slidingFitResultMap) const;
 
     /**
      *  @brief  Split cluster at a given position and direction
@@ -13,6 +13,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArPointingClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 using namespace pandora;
 
@@ -33,6 +34,14 @@ CosmicRaySplittingAlgorithm::CosmicRaySplittingAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode CosmicRaySplittingAlgorithm::Reset()
+{
+    LArSlidingFitCacheHelper::Reset(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CosmicRaySplittingAlgorithm::Run()
 {
     const ClusterList *pClusterList = NULL;
@@ -43,7 +52,7 @@ StatusCode CosmicRaySplittingAlgorithm::Run()
     this->GetListOfCleanClusters(pClusterList, clusterVector);
 
     // Calculate sliding fit results for clean clusters
-    TwoDSlidingFitResultMap slidingFitResultMap;
+    TwoDSlidingFitResultPtrMap slidingFitResultMap;
     this->BuildSlidingFitResultMap(clusterVector, slidingFitResultMap);
 
     // Loop over clusters, identify and perform splits
@@ -54,12 +63,12 @@ StatusCode CosmicRaySplittingAlgorithm::Run()
         if (splitClusters.count(*bIter) > 0)
             continue;
 
-        TwoDSlidingFitResultMap::const_iterator bFitIter = slidingFitResultMap.find(*bIter);
+        TwoDSlidingFitResultPtrMap::const_iterator bFitIter = slidingFitResultMap.find(*bIter);
 
         if (slidingFitResultMap.end() == bFitIter)
             continue;
 
-        const TwoDSlidingFitResult &branchSlidingFitResult(bFitIter->second);
+        const TwoDSlidingFitResult &branchSlidingFitResult(*(bFitIter->second));
 
         // Find best split position for candidate branch cluster
         CartesianVector splitPosition(0.f, 0.f, 0.f);
@@ -70,8 +79,8 @@ StatusCode CosmicRaySplittingAlgorithm::Run()
             continue;
 
         // Find candidate replacement clusters to merge into branch cluster at the split position
-        TwoDSlidingFitResultMap::const_iterator bestReplacementIter1(slidingFitResultMap.end());
-        TwoDSlidingFitResultMap::const_iterator bestReplacementIter2(slidingFitResultMap.end());
+        TwoDSlidingFitResultPtrMap::const_iterator bestReplacementIter1(slidingFitResultMap.end());
+        TwoDSlidingFitResultPtrMap::const_iterator bestReplacementIter2(slidingFitResultMap.end());
 
         float bestLengthSquared1(m_maxLongitudinalDisplacementSquared);
         float bestLengthSquared2(m_maxLongitudinalDisplacementSquared);
@@ -81,12 +90,12 @@ StatusCode CosmicRaySplittingAlgorithm::Run()
             if (splitClusters.count(*rIter) > 0)
                 continue;
 
-            TwoDSlidingFitResultMap::const_iterator rFitIter = slidingFitResultMap.find(*rIter);
+            TwoDSlidingFitResultPtrMap::const_iterator rFitIter = slidingFitResultMap.find(*rIter);
 
             if (slidingFitResultMap.end() == rFitIter)
                 continue;
 
-            const TwoDSlidingFitResult &replacementSlidingFitResult(rFitIter->second);
+            const TwoDSlidingFitResult &replacementSlidingFitResult(*(rFitIter->second));
 
             if (branchSlidingFitResult.GetCluster() == replacementSlidingFitResult.GetCluster())
                 continue;
@@ -178,7 +187,7 @@ void CosmicRaySplittingAlgorithm::GetListOfCleanClusters(const ClusterList *cons
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void CosmicRaySplittingAlgorithm::BuildSlidingFitResultMap(const ClusterVector &clusterVector, TwoDSlidingFitResultMap &slidingFitResultMap) const
+void CosmicRaySplittingAlgorithm::BuildSlidingFitResultMap(const ClusterVector &clusterVector, TwoDSlidingFitResultPtrMap &slidingFitResultMap) const
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
@@ -188,9 +197,10 @@ void CosmicRaySplittingAlgorithm::BuildSlidingFitResultMap(const ClusterVector &
         {
             try
             {
-                const TwoDSlidingFitResult slidingFitResult(*iter, m_halfWindowLayers, slidingFitPitch);
+                const TwoDSlidingFitResultPtr pSlidingFitResult(
+                    LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), *iter, m_halfWindowLayers, slidingFitPitch));
 
-                if (!slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(*iter, slidingFitResult)).second)
+                if (!slidingFitResultMap.insert(TwoDSlidingFitResultPtrMap::value_type(*iter, pSlidingFitResult)).second)
                     throw StatusCodeException(STATUS_CODE_FAILURE);
             }
             catch (StatusCodeException &statusCodeException)
@@ -361,7 +371,11 @@ StatusCode CosmicRaySplittingAlgorithm::PerformSingleSplit(const Cluster *const
     this->GetCaloHitListToKeep(pBranchCluster, caloHitListToMove, caloHitListToKeep);
 
     if (caloHitListToKeep.empty())
+    {
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pReplacementCluster);
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pBranchCluster);
         return PandoraContentApi::MergeAndDeleteClusters(*this, pReplacementCluster, pBranchCluster);
+    }
 
     return this->SplitCluster(pBranchCluster, pReplacementCluster, caloHitListToMove);
 }
@@ -387,7 +401,11 @@ StatusCode CosmicRaySplittingAlgorithm::PerformDoubleSplit(const Cluster *const
     this->GetCaloHitListToKeep(pBranchCluster, caloHitListToMove2, caloHitListToKeep2);
 
     if (caloHitListToKeep2.empty())
+    {
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pReplacementCluster2);
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pBranchCluster);
         return PandoraContentApi::MergeAndDeleteClusters(*this, pReplacementCluster2, pBranchCluster);
+    }
 
     return this->SplitCluster(pBranchCluster, pReplacementCluster2, caloHitListToMove2);
 }
@@ -516,6 +534,9 @@ StatusCode CosmicRaySplittingAlgorithm::SplitCluster(
     if (caloHitListToMove.empty())
         return STATUS_CODE_FAILURE;
 
+    LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pBranchCluster);
+    LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pReplacementCluster);
+
     for (CaloHitList::const_iterator iter = caloHitListToMove.begin(), iterEnd = caloHitListToMove.end(); iter != iterEnd; ++iter)
     {
         const CaloHit *const pCaloHit = *iter;
@@ -27,6 +27,7 @@ public:
     CosmicRaySplittingAlgorithm();
 
 private:
+    pandora::StatusCode Reset();
     pandora::StatusCode Run();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -44,7 +45,7 @@ private:
      *  @param  clusterVector the input cluster vector
      *  @param  slidingFitResultMap the output sliding fit result map
      */
-    void BuildSlidingFitResultMap(const pandora::ClusterVector &clusterVector, TwoDSlidingFitResultMap &slidingFitResultMap) const;
+    void BuildSlidingFitResultMap(const pandora::ClusterVector &clusterVector, TwoDSlidingFitResultPtrMap &slidingFitResultMap) const;
 
     /**
      *  @brief  Find the position of greatest scatter along a sliding linear fit
@@ -12,6 +12,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArHitWidthHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 using namespace pandora;
 
@@ -40,7 +41,7 @@ StatusCode TrackMergeRefinementAlgorithm::Run()
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
 
     ClusterVector clusterVector;
-    TwoDSlidingFitResultMap microSlidingFitResultMap, macroSlidingFitResultMap;
+    TwoDSlidingFitResultPtrMap microSlidingFitResultMap, macroSlidingFitResultMap;
     SlidingFitResultMapPair slidingFitResultMapPair({&microSlidingFitResultMap, &macroSlidingFitResultMap});
 
     this->InitialiseContainers(pClusterList, LArClusterHelper::SortByNHits, clusterVector, slidingFitResultMapPair);
@@ -99,11 +100,11 @@ bool TrackMergeRefinementAlgorithm::FindBestClusterAssociation(const ClusterVect
     {
         const Cluster *const pCurrentCluster(*currentIter);
 
-        const TwoDSlidingFitResultMap::const_iterator currentMicroFitIter(slidingFitResultMapPair.first->find(pCurrentCluster));
+        const TwoDSlidingFitResultPtrMap::const_iterator currentMicroFitIter(slidingFitResultMapPair.first->find(pCurrentCluster));
         if (currentMicroFitIter == slidingFitResultMapPair.first->end())
             return false;
 
-        const TwoDSlidingFitResultMap::const_iterator currentMacroFitIter(slidingFitResultMapPair.second->find(pCurrentCluster));
+        const TwoDSlidingFitResultPtrMap::const_iterator currentMacroFitIter(slidingFitResultMapPair.second->find(pCurrentCluster));
         if (currentMacroFitIter == slidingFitResultMapPair.second->end())
             return false;
 
@@ -115,21 +116,21 @@ bool TrackMergeRefinementAlgorithm::FindBestClusterAssociation(const ClusterVect
             if ((lengthSum < maxLength) || (lengthSum < m_minClusterLengthSum))
                 continue;
 
-            const TwoDSlidingFitResultMap::const_iterator testMicroFitIter(slidingFitResultMapPair.first->find(pTestCluster));
+            const TwoDSlidingFitResultPtrMap::const_iterator testMicroFitIter(slidingFitResultMapPair.first->find(pTestCluster));
             if (testMicroFitIter == slidingFitResultMapPair.first->end())
                 continue;
 
-            const TwoDSlidingFitResultMap::const_iterator testMacroFitIter(slidingFitResultMapPair.second->find(pTestCluster));
+            const TwoDSlidingFitResultPtrMap::const_iterator testMacroFitIter(slidingFitResultMapPair.second->find(pTestCluster));
             if (testMacroFitIter == slidingFitResultMapPair.second->end())
                 continue;
 
             const bool isCurrentUpstream(LArClusterHelper::SortByPosition(pCurrentCluster, pTestCluster));
 
             // ATTN: Ensure that clusters are not contained within one another
-            const float currentMinLayerZ(currentMacroFitIter->second.GetGlobalMinLayerPosition().GetZ()),
-                currentMaxLayerZ(currentMacroFitIter->second.GetGlobalMaxLayerPosition().GetZ());
-            const float testMinLayerZ(testMacroFitIter->second.GetGlobalMinLayerPosition().GetZ()),
-                testMaxLayerZ(testMacroFitIter->second.GetGlobalMaxLayerPosition().GetZ());
+            const float currentMinLayerZ(currentMacroFitIter->second->GetGlobalMinLayerPosition().GetZ()),
+                currentMaxLayerZ(currentMacroFitIter->second->GetGlobalMaxLayerPosition().GetZ());
+            const float testMinLayerZ(testMacroFitIter->second->GetGlobalMinLayerPosition().GetZ()),
+                testMaxLayerZ(testMacroFitIter->second->GetGlobalMaxLayerPosition().GetZ());
 
             if (((currentMinLayerZ > testMinLayerZ) && (currentMaxLayerZ < testMaxLayerZ)) ||
                 ((testMinLayerZ > currentMinLayerZ) && (testMaxLayerZ < currentMaxLayerZ)))
@@ -137,10 +138,10 @@ bool TrackMergeRefinementAlgorithm::FindBestClusterAssociation(const ClusterVect
 
             CartesianVector currentMergePoint(0.f, 0.f, 0.f), testMergePoint(0.f, 0.f, 0.f), currentMergeDirection(0.f, 0.f, 0.f),
                 testMergeDirection(0.f, 0.f, 0.f);
-            if (!this->GetClusterMergingCoordinates(currentMicroFitIter->second, currentMacroFitIter->second, testMacroFitIter->second,
-                    !isCurrentUpstream, currentMergePoint, currentMergeDirection) ||
-                !this->GetClusterMergingCoordinates(testMicroFitIter->second, testMacroFitIter->second, currentMacroFitIter->second,
-                    isCurrentUpstream, testMergePoint, testMergeDirection))
+            if (!this->GetClusterMergingCoordinates(*(currentMicroFitIter->second), *(currentMacroFitIter->second),
+                    *(testMacroFitIter->second), !isCurrentUpstream, currentMergePoint, currentMergeDirection) ||
+                !this->GetClusterMergingCoordinates(*(testMicroFitIter->second), *(testMacroFitIter->second),
+                    *(currentMacroFitIter->second), isCurrentUpstream, testMergePoint, testMergeDirection))
             {
                 continue;
             }
@@ -265,6 +266,8 @@ const Cluster *TrackMergeRefinementAlgorithm::CreateMainTrack(const ClusterPairA
         this->RemoveOffAxisHitsFromTrack(clusterAssociation.GetDownstreamCluster(), clusterAssociation.GetDownstreamMergePoint(), true,
             clusterToCaloHitListMap, remnantClusterList, *slidingFitResultMapPair.first, *slidingFitResultMapPair.second));
 
+    LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pMainTrackCluster);
+    LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pClusterToDelete);
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pMainTrackCluster, pClusterToDelete));
 
     for (const Cluster *const pShowerCluster : showerClustersToFragment)
@@ -12,6 +12,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArHitWidthHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 using namespace pandora;
 
@@ -49,11 +50,13 @@ void TrackRefinementBaseAlgorithm::InitialiseContainers(const ClusterList *pClus
 
         try
         {
-            const TwoDSlidingFitResult microSlidingFitResult(pCluster, m_microSlidingFitWindow, slidingFitPitch);
-            const TwoDSlidingFitResult macroSlidingFitResult(pCluster, m_macroSlidingFitWindow, slidingFitPitch);
+            const TwoDSlidingFitResultPtr pMicroSlidingFitResult(
+                LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, m_microSlidingFitWindow, slidingFitPitch));
+            const TwoDSlidingFitResultPtr pMacroSlidingFitResult(
+                LArSlidingFitCacheHelper::GetSlidingFitResult(this->GetPandora(), pCluster, m_macroSlidingFitWindow, slidingFitPitch));
 
-            slidingFitResultMapPair.first->insert(TwoDSlidingFitResultMap::value_type(pCluster, microSlidingFitResult));
-            slidingFitResultMapPair.second->insert(TwoDSlidingFitResultMap::value_type(pCluster, macroSlidingFitResult));
+            slidingFitResultMapPair.first->insert(TwoDSlidingFitResultPtrMap::value_type(pCluster, pMicroSlidingFitResult));
+            slidingFitResultMapPair.second->insert(TwoDSlidingFitResultPtrMap::value_type(pCluster, pMacroSlidingFitResult));
             clusterVector.push_back(pCluster);
         }
         catch (const StatusCodeException &)
@@ -495,13 +498,13 @@ bool TrackRefinementBaseAlgorithm::IsInLineSegment(
 
 const Cluster *TrackRefinementBaseAlgorithm::RemoveOffAxisHitsFromTrack(const Cluster *const pCluster, const CartesianVector &splitPosition,
     const bool isEndUpstream, const ClusterToCaloHitListMap &clusterToCaloHitListMap, ClusterList &remnantClusterList,
-    TwoDSlidingFitResultMap &microSlidingFitResultMap, TwoDSlidingFitResultMap &macroSlidingFitResultMap) const
+    TwoDSlidingFitResultPtrMap &microSlidingFitResultMap, TwoDSlidingFitResultPtrMap &macroSlidingFitResultMap) const
 {
     float rL(0.f), rT(0.f);
-    const TwoDSlidingFitResult &microFitResult(microSlidingFitResultMap.at(pCluster));
+    const TwoDSlidingFitResult &microFitResult(*(microSlidingFitResultMap.at(pCluster)));
     microFitResult.GetLocalPosition(splitPosition, rL, rT);
 
-    const TwoDSlidingFitResult &macroFitResult(macroSlidingFitResultMap.at(pCluster));
+    const TwoDSlidingFitResult &macroFitResult(*(macroSlidingFitResultMap.at(pCluster)));
     CartesianVector averageDirection(0.f, 0.f, 0.f);
     macroFitResult.GetGlobalDirection(macroFitResult.GetLayerFitResultMap().begin()->second.GetGradient(), averageDirection);
 
@@ -558,6 +561,7 @@ const Cluster *TrackRefinementBaseAlgorithm::RemoveOffAxisHitsFromTrack(const Cl
     // End fragmentation
     if (pAboveCluster || pBelowCluster)
     {
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pCluster);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndFragmentation(*this, fragmentListName, originalListName));
         return pMainTrackCluster;
     }
@@ -580,6 +584,8 @@ void TrackRefinementBaseAlgorithm::AddHitsToMainTrack(const Cluster *const pMain
 
     if (pShowerCluster->GetNCaloHits() == caloHitsToMerge.size())
     {
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pMainTrackCluster);
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pShowerCluster);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pMainTrackCluster, pShowerCluster));
         return;
     }
@@ -633,6 +639,8 @@ void TrackRefinementBaseAlgorithm::AddHitsToMainTrack(const Cluster *const pMain
         }
     }
 
+    LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pMainTrackCluster);
+    LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pShowerCluster);
     PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndFragmentation(*this, fragmentListName, originalListName));
 }
 
@@ -690,6 +698,8 @@ bool TrackRefinementBaseAlgorithm::AddToNearestCluster(
 
     if (closestDistance < m_maxHitDistanceFromCluster)
     {
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pClosestCluster);
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pClusterToMerge);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pClosestCluster, pClusterToMerge));
         return true;
     }
@@ -782,6 +792,7 @@ void TrackRefinementBaseAlgorithm::FragmentRemnantCluster(const Cluster *const p
     }
     else
     {
+        LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pRemnantCluster);
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndFragmentation(*this, fragmentListName, originalListName));
         fragmentedClusterList.insert(fragmentedClusterList.begin(), createdClusters.begin(), createdClusters.end());
     }
@@ -805,11 +816,11 @@ void TrackRefinementBaseAlgorithm::UpdateContainers(const ClusterList &clustersT
 void TrackRefinementBaseAlgorithm::RemoveClusterFromContainers(
     const Cluster *const pClusterToRemove, ClusterVector &clusterVector, SlidingFitResultMapPair &slidingFitResultMapPair) const
 {
-    const TwoDSlidingFitResultMap::const_iterator microFitToDelete(slidingFitResultMapPair.first->find(pClusterToRemove));
+    const TwoDSlidingFitResultPtrMap::const_iterator microFitToDelete(slidingFitResultMapPair.first->find(pClusterToRemove));
     if (microFitToDelete != slidingFitResultMapPair.first->end())
         slidingFitResultMapPair.first->erase(microFitToDelete);
 
-    const TwoDSlidingFitResultMap::const_iterator macroFitToDelete(slidingFitResultMapPair.second->find(pClusterToRemove));
+    const TwoDSlidingFitResultPtrMap::const_iterator macroFitToDelete(slidingFitResultMapPair.second->find(pClusterToRemove));
     if (macroFitToDelete != slidingFitResultMapPair.second->end())
         slidingFitResultMapPair.second->erase(macroFitToDelete);
 
@@ -820,6 +831,14 @@ void TrackRefinementBaseAlgorithm::RemoveClusterFromContainers(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TrackRefinementBaseAlgorithm::Reset()
+{
+    LArSlidingFitCacheHelper::Reset(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TrackRefinementBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(
@@ -27,7 +27,7 @@ public:
     TrackRefinementBaseAlgorithm();
 
 protected:
-    typedef std::pair<TwoDSlidingFitResultMap *, TwoDSlidingFitResultMap *> SlidingFitResultMapPair;
+    typedef std::pair<TwoDSlidingFitResultPtrMap *, TwoDSlidingFitResultPtrMap *> SlidingFitResultMapPair;
     typedef std::unordered_map<const pandora::Cluster *, pandora::CaloHitList> ClusterToCaloHitListMap;
 
     /**
@@ -61,6 +61,7 @@ protected:
         bool m_hitWidthMode;                      ///< Wether to consider hit widths or not
     };
 
+    virtual pandora::StatusCode Reset();
     virtual pandora::StatusCode Run() = 0;
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle) = 0;
 
@@ -227,7 +228,7 @@ protected:
      */
     const pandora::Cluster *RemoveOffAxisHitsFromTrack(const pandora::Cluster *const pCluster, const pandora::CartesianVector &splitPosition,
         const bool isEndUpstream, const ClusterToCaloHitListMap &clusterToCaloHitListMap, pandora::ClusterList &remnantClusterList,
-        TwoDSlidingFitResultMap &microSlidingFitResultMap, TwoDSlidingFitResultMap &macroSlidingFitResultMap) const;
+        TwoDSlidingFitResultPtrMap &microSlidingFitResultMap, TwoDSlidingFitResultPtrMap &macroSlidingFitResultMap) const;
 
     /**
      *  @brief  Remove the hits from a shower cluster that belong to the main track and add them into the main track cluster
@@ -0,0 +1,525 @@
+/**
+ *  @file   larpandoracontent/LArUtility/FlatKDTreeLinkerAlgoT.h
+ *
+ *  @brief  Header file for the flat kd tree linker algo template class
+ *
+ *  $Log: $
+ */
+#ifndef LAR_FLAT_KD_TREE_LINKER_ALGO_TEMPLATED_H
+#define LAR_FLAT_KD_TREE_LINKER_ALGO_TEMPLATED_H 1
+
+#include "KDTreeLinkerToolsT.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  Class that implements the KDTree partition of space with the same interface as KDTreeLinkerAlgo, but using a flat layout.
+ *          Nodes are held in a single array and refer to their sons by index. Each subtree owns a contiguous range of the (reordered)
+ *          elements, with leaves holding buckets of up to BUCKET elements whose coordinates are also stored structure-of-arrays, so
+ *          that leaf tests are simple, branch-free loops over contiguous floats, suitable for vectorisation by the compiler.
+ *
+ *          Box searches include every point lying exactly on the box boundary, whereas KDTreeLinkerAlgo can miss such points when
+ *          they also lie on a splitting plane. Otherwise, results are the same sets of points as those provided by KDTreeLinkerAlgo,
+ *          but may be provided in a different order. Algorithms therefore opt in explicitly, by choosing this class in their kd tree
+ *          typedef, only where neither difference can change their output.
+ */
+template <typename DATA, unsigned DIM = 2>
+class FlatKDTreeLinkerAlgo
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    FlatKDTreeLinkerAlgo();
+
+    /**
+     *  @brief  Build the KD tree from the "eltList". The tree bounds are derived from the elements themselves, with the region
+     *          accepted only for interface compatibility with KDTreeLinkerAlgo
+     *
+     *  @param  eltList
+     *  @param  region
+     */
+    void build(std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, const KDTreeBoxT<DIM> &region);
+
+    /**
+     *  @brief  Search in the KDTree for all points that would be contained in the given searchbox
+     *          The founded points are stored in resRecHitList
+     *
+     *  @param  searchBox
+     *  @param  resRecHitList
+     */
+    void search(const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const;
+
+    /**
+     *  @brief  Search in the KDTree for all points within a given distance of a specified point (the boundary is inclusive)
+     *
+     *  @param  point
+     *  @param  radius
+     *  @param  resRecHitList
+     */
+    void searchRadius(const KDTreeNodeInfoT<DATA, DIM> &point, const float radius, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const;
+
+    /**
+     *  @brief  findNearestNeighbour
+     *
+     *  @param  point
+     *  @param  result
+     *  @param  distance
+     */
+    void findNearestNeighbour(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance) const;
+
+    /**
+     *  @brief  Whether the tree is empty
+     *
+     *  @return boolean
+     */
+    bool empty() const;
+
+    /**
+     *  @brief  Return the number of nodes (internal nodes and leaf buckets) in the tree
+     *
+     *  @return the number of nodes in the tree
+     */
+    int size() const;
+
+    /**
+     *  @brief  Clear all allocated structures
+     */
+    void clear();
+
+private:
+    static const unsigned int BUCKET = 16; ///< The maximum number of elements in a leaf bucket
+
+    /**
+     *  @brief  Flat tree node, owning the contiguous element range [begin, end)
+     */
+    class FlatNode
+    {
+    public:
+        KDTreeBoxT<DIM> bounds; ///< Tight bounding box of the node elements
+        unsigned begin;         ///< Index of the first node element
+        unsigned end;           ///< Index one past the last node element
+        int left;               ///< Index of the left son, or -1 for a leaf
+        int right;              ///< Index of the right son, or -1 for a leaf
+    };
+
+    /**
+     *  @brief  Recursive flat kdtree builder. Is called by build()
+     *
+     *  @param  begin
+     *  @param  end
+     *
+     *  @return the index of the new node
+     */
+    int recBuild(const unsigned begin, const unsigned end);
+
+    /**
+     *  @brief  Recursive flat kdtree search. Is called by search()
+     *
+     *  @param  nodeIndex
+     *  @param  trackBox
+     *  @param  recHits
+     */
+    void recSearch(const int nodeIndex, const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
+
+    /**
+     *  @brief  Recursive flat kdtree radius search. Is called by searchRadius()
+     *
+     *  @param  nodeIndex
+     *  @param  point
+     *  @param  radius2 the squared search radius
+     *  @param  recHits
+     */
+    void recSearchRadius(const int nodeIndex, const KDTreeNodeInfoT<DATA, DIM> &point, const float radius2,
+        std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
+
+    /**
+     *  @brief  Recursive nearest neighbour search. Is called by findNearestNeighbour()
+     *
+     *  @param  nodeIndex
+     *  @param  point
+     *  @param  bestIndex the index of the closest element found so far
+     *  @param  bestDist2 the squared distance to the closest element found so far
+     */
+    void recNearestNeighbour(const int nodeIndex, const KDTreeNodeInfoT<DATA, DIM> &point, int &bestIndex, float &bestDist2) const;
+
+    /**
+     *  @brief  Calculate the squared distances from a point to each of the elements in a leaf bucket
+     *
+     *  @param  node the leaf node
+     *  @param  point
+     *  @param  distances2 to receive the squared distances, indexed from the start of the bucket
+     */
+    void bucketDist2(const FlatNode &node, const KDTreeNodeInfoT<DATA, DIM> &point, std::array<float, BUCKET> &distances2) const;
+
+    /**
+     *  @brief  The squared distances from a point to the closest and furthest points of a region
+     *
+     *  @param  point
+     *  @param  region
+     *  @param  minDist2 to receive the squared distance to the closest point of the region
+     *  @param  maxDist2 to receive the squared distance to the furthest point of the region
+     */
+    void regionDist2(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeBoxT<DIM> &region, float &minDist2, float &maxDist2) const;
+
+    /**
+     *  @brief  Append a contiguous range of elements to a result list
+     *
+     *  @param  node the node owning the range
+     *  @param  recHits
+     */
+    void addRange(const FlatNode &node, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
+
+    std::vector<FlatNode> nodes_;                      ///< The tree nodes, with the root at index zero
+    std::vector<KDTreeNodeInfoT<DATA, DIM>> elements_; ///< The elements, ordered such that each subtree owns a contiguous range
+    std::array<std::vector<float>, DIM> coordinates_;  ///< The element coordinates, structure-of-arrays, in the same order as elements_
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline FlatKDTreeLinkerAlgo<DATA, DIM>::FlatKDTreeLinkerAlgo()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void FlatKDTreeLinkerAlgo<DATA, DIM>::build(std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, const KDTreeBoxT<DIM> &)
+{
+    this->clear();
+
+    if (eltList.empty())
+        return;
+
+    elements_ = eltList;
+    nodes_.reserve(2 * ((elements_.size() + BUCKET - 1) / BUCKET));
+    this->recBuild(0, elements_.size());
+
+    for (unsigned i = 0; i < DIM; ++i)
+    {
+        coordinates_[i].reserve(elements_.size());
+
+        for (const KDTreeNodeInfoT<DATA, DIM> &element : elements_)
+            coordinates_[i].push_back(element.dims[i]);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline int FlatKDTreeLinkerAlgo<DATA, DIM>::recBuild(const unsigned begin, const unsigned end)
+{
+    FlatNode node;
+    node.begin = begin;
+    node.end = end;
+    node.left = -1;
+    node.right = -1;
+    node.bounds.dimmin = elements_[begin].dims;
+    node.bounds.dimmax = elements_[begin].dims;
+
+    for (unsigned index = begin + 1; index < end; ++index)
+    {
+        for (unsigned i = 0; i < DIM; ++i)
+        {
+            node.bounds.dimmin[i] = std::min(node.bounds.dimmin[i], elements_[index].dims[i]);
+            node.bounds.dimmax[i] = std::max(node.bounds.dimmax[i], elements_[index].dims[i]);
+        }
+    }
+
+    const int nodeIndex(nodes_.size());
+    nodes_.push_back(node);
+
+    if (end - begin <= BUCKET)
+        return nodeIndex;
+
+    // Split at the median of the dimension in which the node elements are most widely spread
+    unsigned thedim = 0;
+
+    for (unsigned i = 1; i < DIM; ++i)
+    {
+        if ((node.bounds.dimmax[i] - node.bounds.dimmin[i]) > (node.bounds.dimmax[thedim] - node.bounds.dimmin[thedim]))
+            thedim = i;
+    }
+
+    const unsigned median = begin + (end - begin) / 2;
+    std::nth_element(elements_.begin() + begin, elements_.begin() + median, elements_.begin() + end,
+        [thedim](const KDTreeNodeInfoT<DATA, DIM> &lhs, const KDTreeNodeInfoT<DATA, DIM> &rhs) { return lhs.dims[thedim] < rhs.dims[thedim]; });
+
+    // ATTN Sons are built before being linked, as building may reallocate the node array
+    const int left = this->recBuild(begin, median);
+    const int right = this->recBuild(median, end);
+    nodes_[nodeIndex].left = left;
+    nodes_[nodeIndex].right = right;
+
+    return nodeIndex;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void FlatKDTreeLinkerAlgo<DATA, DIM>::search(const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
+{
+    if (!nodes_.empty())
+        this->recSearch(0, trackBox, recHits);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void FlatKDTreeLinkerAlgo<DATA, DIM>::recSearch(
+    const int nodeIndex, const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
+{
+    const FlatNode &node(nodes_[nodeIndex]);
+
+    bool isFullyContained = true;
+    bool hasIntersection = true;
+
+    for (unsigned i = 0; i < DIM; ++i)
+    {
+        isFullyContained = isFullyContained && (node.bounds.dimmin[i] >= trackBox.dimmin[i] && node.bounds.dimmax[i] <= trackBox.dimmax[i]);
+        hasIntersection = hasIntersection && (node.bounds.dimmin[i] <= trackBox.dimmax[i] && node.bounds.dimmax[i] >= trackBox.dimmin[i]);
+    }
+
+    if (!hasIntersection)
+        return;
+
+    if (isFullyContained)
+    {
+        this->addRange(node, recHits);
+    }
+    else if (node.left < 0)
+    {
+        // Leaf case, testing each dimension of the whole bucket in turn
+        const unsigned nElements = node.end - node.begin;
+        std::array<unsigned char, BUCKET> isInside;
+        isInside.fill(1);
+
+        for (unsigned i = 0; i < DIM; ++i)
+        {
+            const float *const coordinates = coordinates_[i].data() + node.begin;
+            const float low = trackBox.dimmin[i], high = trackBox.dimmax[i];
+
+            for (unsigned j = 0; j < nElements; ++j)
+                isInside[j] &= static_cast<unsigned char>((coordinates[j] >= low) & (coordinates[j] <= high));
+        }
+
+        for (unsigned j = 0; j < nElements; ++j)
+        {
+            if (isInside[j])
+                recHits.push_back(elements_[node.begin + j]);
+        }
+    }
+    else
+    {
+        this->recSearch(node.left, trackBox, recHits);
+        this->recSearch(node.right, trackBox, recHits);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void FlatKDTreeLinkerAlgo<DATA, DIM>::searchRadius(
+    const KDTreeNodeInfoT<DATA, DIM> &point, const float radius, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
+{
+    if (!nodes_.empty() && (radius >= 0.f))
+        this->recSearchRadius(0, point, radius * radius, recHits);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void FlatKDTreeLinkerAlgo<DATA, DIM>::recSearchRadius(
+    const int nodeIndex, const KDTreeNodeInfoT<DATA, DIM> &point, const float radius2, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
+{
+    const FlatNode &node(nodes_[nodeIndex]);
+
+    float minDist2(0.f), maxDist2(0.f);
+    this->regionDist2(point, node.bounds, minDist2, maxDist2);
+
+    if (minDist2 > radius2)
+        return;
+
+    if (maxDist2 <= radius2)
+    {
+        this->addRange(node, recHits);
+    }
+    else if (node.left < 0)
+    {
+        std::array<float, BUCKET> distances2;
+        this->bucketDist2(node, point, distances2);
+
+        for (unsigned j = 0, nElements = node.end - node.begin; j < nElements; ++j)
+        {
+            if (distances2[j] <= radius2)
+                recHits.push_back(elements_[node.begin + j]);
+        }
+    }
+    else
+    {
+        this->recSearchRadius(node.left, point, radius2, recHits);
+        this->recSearchRadius(node.right, point, radius2, recHits);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void FlatKDTreeLinkerAlgo<DATA, DIM>::findNearestNeighbour(
+    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance) const
+{
+    result = nullptr;
+    distance = std::numeric_limits<float>::max();
+
+    if (nodes_.empty())
+        return;
+
+    int bestIndex(-1);
+    float bestDist2(std::numeric_limits<float>::max());
+    this->recNearestNeighbour(0, point, bestIndex, bestDist2);
+
+    if (bestIndex >= 0)
+    {
+        result = &(elements_[bestIndex]);
+        distance = std::sqrt(bestDist2);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void FlatKDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(
+    const int nodeIndex, const KDTreeNodeInfoT<DATA, DIM> &point, int &bestIndex, float &bestDist2) const
+{
+    const FlatNode &node(nodes_[nodeIndex]);
+
+    if (node.left < 0)
+    {
+        std::array<float, BUCKET> distances2;
+        this->bucketDist2(node, point, distances2);
+
+        for (unsigned j = 0, nElements = node.end - node.begin; j < nElements; ++j)
+        {
+            if ((bestIndex < 0) || (distances2[j] < bestDist2))
+            {
+                bestIndex = node.begin + j;
+                bestDist2 = distances2[j];
+            }
+        }
+
+        return;
+    }
+
+    // Node case, visiting the son whose bounds are closest to the point first
+    float minDist2Left(0.f), minDist2Right(0.f), maxDist2(0.f);
+    this->regionDist2(point, nodes_[node.left].bounds, minDist2Left, maxDist2);
+    this->regionDist2(point, nodes_[node.right].bounds, minDist2Right, maxDist2);
+
+    const bool leftFirst(minDist2Left <= minDist2Right);
+    const int sons[2] = {leftFirst ? node.left : node.right, leftFirst ? node.right : node.left};
+    const float sonMinDist2s[2] = {leftFirst ? minDist2Left : minDist2Right, leftFirst ? minDist2Right : minDist2Left};
+
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        if ((bestIndex < 0) || (sonMinDist2s[i] < bestDist2))
+            this->recNearestNeighbour(sons[i], point, bestIndex, bestDist2);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void FlatKDTreeLinkerAlgo<DATA, DIM>::bucketDist2(
+    const FlatNode &node, const KDTreeNodeInfoT<DATA, DIM> &point, std::array<float, BUCKET> &distances2) const
+{
+    // ATTN Differences are evaluated and accumulated exactly as in KDTreeLinkerAlgo::dist2, so that distances are identical
+    const unsigned nElements = node.end - node.begin;
+    std::array<double, BUCKET> d;
+    d.fill(0.);
+
+    for (unsigned i = 0; i < DIM; ++i)
+    {
+        const float *const coordinates = coordinates_[i].data() + node.begin;
+        const float pointCoordinate = point.dims[i];
+
+        for (unsigned j = 0; j < nElements; ++j)
+        {
+            const double diff = coordinates[j] - pointCoordinate;
+            d[j] += diff * diff;
+        }
+    }
+
+    for (unsigned j = 0; j < nElements; ++j)
+        distances2[j] = (float)d[j];
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void FlatKDTreeLinkerAlgo<DATA, DIM>::regionDist2(
+    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeBoxT<DIM> &region, float &minDist2, float &maxDist2) const
+{
+    double dmin = 0., dmax = 0.;
+
+    for (unsigned i = 0; i < DIM; ++i)
+    {
+        const double below = region.dimmin[i] - point.dims[i];
+        const double above = point.dims[i] - region.dimmax[i];
+        const double outside = std::max(0., std::max(below, above));
+        const double furthest = std::max(std::fabs(below), std::fabs(above));
+        dmin += outside * outside;
+        dmax += furthest * furthest;
+    }
+
+    minDist2 = (float)dmin;
+    maxDist2 = (float)dmax;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void FlatKDTreeLinkerAlgo<DATA, DIM>::addRange(const FlatNode &node, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
+{
+    recHits.insert(recHits.end(), elements_.begin() + node.begin, elements_.begin() + node.end);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline bool FlatKDTreeLinkerAlgo<DATA, DIM>::empty() const
+{
+    return nodes_.empty();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline int FlatKDTreeLinkerAlgo<DATA, DIM>::size() const
+{
+    return nodes_.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void FlatKDTreeLinkerAlgo<DATA, DIM>::clear()
+{
+    nodes_.clear();
+    elements_.clear();
+
+    for (unsigned i = 0; i < DIM; ++i)
+        coordinates_[i].clear();
+}
+
+} // namespace lar_content
+
+#endif // LAR_FLAT_KD_TREE_LINKER_ALGO_TEMPLATED_H
@@ -10,13 +10,18 @@
 
 #include "KDTreeLinkerToolsT.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
 #include <vector>
 
 namespace lar_content
 {
 
 /**
- *  @brief  Class that implements the KDTree partition of 2D space and a closest point search algorithm
+ *  @brief  Class that implements the KDTree partition of 2D space and a closest point search algorithm. Once built, the tree holds no
+ *          query state, so all queries are const and may be issued concurrently from several threads.
  */
 template <typename DATA, unsigned DIM = 2>
 class KDTreeLinkerAlgo
@@ -47,7 +52,17 @@ public:
      *  @param  searchBox
      *  @param  resRecHitList
      */
-    void search(const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList);
+    void search(const KDTreeBoxT<DIM> &searchBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const;
+
+    /**
+     *  @brief  Search in the KDTree for all points within a given distance of a specified point (the boundary is inclusive)
+     *          The founded points are stored in resRecHitList, in the order in which a box search would provide them
+     *
+     *  @param  point
+     *  @param  radius
+     *  @param  resRecHitList
+     */
+    void searchRadius(const KDTreeNodeInfoT<DATA, DIM> &point, const float radius, std::vector<KDTreeNodeInfoT<DATA, DIM>> &resRecHitList) const;
 
     /**
      *  @brief  findNearestNeighbour
@@ -56,21 +71,21 @@ public:
      *  @param  result
      *  @param  distance
      */
-    void findNearestNeighbour(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance);
+    void findNearestNeighbour(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance) const;
 
     /**
      *  @brief  Whether the tree is empty
      *
      *  @return boolean
      */
-    bool empty();
+    bool empty() const;
 
     /**
      *  @brief  Return the number of nodes + leaves in the tree (nElements should be (size() +1) / 2)
      *
      *  @return the number of nodes + leaves in the tree
      */
-    int size();
+    int size() const;
 
     /**
      *  @brief  Clear all allocated structures
@@ -88,29 +103,43 @@ private:
     /**
      *  @brief  Fast median search with Wirth algorithm in eltList between low and high indexes.
      *
+     *  @param  eltList
      *  @param  low
      *  @param  high
      *  @param  treeDepth
      */
-    int medianSearch(int low, int high, int treeDepth);
+    int medianSearch(std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, int low, int high, int treeDepth) const;
 
     /**
      *  @brief  Recursive kdtree builder. Is called by build()
      *
+     *  @param  eltList
      *  @param  low
      *  @param  high
      *  @param  depth
      *  @param  region
      */
-    KDTreeNodeT<DATA, DIM> *recBuild(int low, int high, int depth, const KDTreeBoxT<DIM> &region);
+    KDTreeNodeT<DATA, DIM> *recBuild(std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, int low, int high, int depth, const KDTreeBoxT<DIM> &region);
 
     /**
      *  @brief  Recursive kdtree search. Is called by search()
      *
      *  @param  current
      *  @param  trackBox
+     *  @param  recHits
      */
-    void recSearch(const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox);
+    void recSearch(const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
+
+    /**
+     *  @brief  Recursive kdtree radius search. Is called by searchRadius()
+     *
+     *  @param  current
+     *  @param  point
+     *  @param  radius2 the squared search radius
+     *  @param  recHits
+     */
+    void recSearchRadius(const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point, const float radius2,
+        std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
 
     /**
      *  @brief  Recursive nearest neighbour search. Is called by findNearestNeighbour()
@@ -122,14 +151,15 @@ private:
      *  @param  best_dist
      */
     void recNearestNeighbour(unsigned depth, const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point,
-        const KDTreeNodeT<DATA, DIM> *&best_match, float &best_dist);
+        const KDTreeNodeT<DATA, DIM> *&best_match, float &best_dist) const;
 
     /**
      *  @brief  Add all elements of an subtree to the closest elements. Used during the recSearch().
      *
      *  @param  current
+     *  @param  recHits
      */
-    void addSubtree(const KDTreeNodeT<DATA, DIM> *current);
+    void addSubtree(const KDTreeNodeT<DATA, DIM> *current, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const;
 
     /**
      *  @brief  dist2
@@ -141,6 +171,16 @@ private:
      */
     float dist2(const KDTreeNodeInfoT<DATA, DIM> &a, const KDTreeNodeInfoT<DATA, DIM> &b) const;
 
+    /**
+     *  @brief  The squared distances from a point to the closest and furthest points of a region
+     *
+     *  @param  point
+     *  @param  region
+     *  @param  minDist2 to receive the squared distance to the closest point of the region
+     *  @param  maxDist2 to receive the squared distance to the furthest point of the region
+     */
+    void regionDist2(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeBoxT<DIM> &region, float &minDist2, float &maxDist2) const;
+
     /**
      *  @brief  Frees the KDTree.
      */
@@ -150,9 +190,6 @@ private:
     KDTreeNodeT<DATA, DIM> *nodePool_; ///< Node pool allows us to do just 1 call to new for each tree building
     int nodePoolSize_;                 ///< The node pool size
     int nodePoolPos_;                  ///< The node pool position
-
-    std::vector<KDTreeNodeInfoT<DATA, DIM>> *closestNeighbour; ///< The closest neighbour
-    std::vector<KDTreeNodeInfoT<DATA, DIM>> *initialEltList;   ///< The initial element list
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -163,9 +200,7 @@ inline KDTreeLinkerAlgo<DATA, DIM>::KDTreeLinkerAlgo() :
     root_(nullptr),
     nodePool_(nullptr),
     nodePoolSize_(-1),
-    nodePoolPos_(-1),
-    closestNeighbour(nullptr),
-    initialEltList(nullptr)
+    nodePoolPos_(-1)
 {
 }
 
@@ -184,22 +219,20 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::build(std::vector<KDTreeNodeInfoT<DATA,
 {
     if (eltList.size())
     {
-        initialEltList = &eltList;
-        const size_t mysize = initialEltList->size();
+        const size_t mysize = eltList.size();
 
         nodePoolSize_ = mysize * 2 - 1;
         nodePool_ = new KDTreeNodeT<DATA, DIM>[nodePoolSize_];
 
         // Here we build the KDTree
-        root_ = this->recBuild(0, mysize, 0, region);
-        initialEltList = nullptr;
+        root_ = this->recBuild(eltList, 0, mysize, 0, region);
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int treeDepth)
+inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, int low, int high, int treeDepth) const
 {
     // We should have at least 1 element to calculate the median...
     //assert(low < high);
@@ -213,7 +246,7 @@ inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int tree
 
     while (l < m)
     {
-        KDTreeNodeInfoT<DATA, DIM> elt = (*initialEltList)[median];
+        KDTreeNodeInfoT<DATA, DIM> elt = eltList[median];
         int i = l;
         int j = m;
 
@@ -221,14 +254,14 @@ inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int tree
         {
             // The even depth is associated to dim1 dimension, the odd one to dim2 dimension
             const unsigned thedim = treeDepth % DIM;
-            while ((*initialEltList)[i].dims[thedim] < elt.dims[thedim])
+            while (eltList[i].dims[thedim] < elt.dims[thedim])
                 ++i;
-            while ((*initialEltList)[j].dims[thedim] > elt.dims[thedim])
+            while (eltList[j].dims[thedim] > elt.dims[thedim])
                 --j;
 
             if (i <= j)
             {
-                std::swap((*initialEltList)[i], (*initialEltList)[j]);
+                std::swap(eltList[i], eltList[j]);
                 i++;
                 j--;
             }
@@ -246,20 +279,27 @@ inline int KDTreeLinkerAlgo<DATA, DIM>::medianSearch(int low, int high, int tree
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::search(const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits)
+inline void KDTreeLinkerAlgo<DATA, DIM>::search(const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
     if (root_)
-    {
-        closestNeighbour = &recHits;
-        this->recSearch(root_, trackBox);
-        closestNeighbour = nullptr;
-    }
+        this->recSearch(root_, trackBox, recHits);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox)
+inline void KDTreeLinkerAlgo<DATA, DIM>::searchRadius(
+    const KDTreeNodeInfoT<DATA, DIM> &point, const float radius, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
+{
+    if (root_ && (radius >= 0.f))
+        this->recSearchRadius(root_, point, radius * radius, recHits);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(
+    const KDTreeNodeT<DATA, DIM> *current, const KDTreeBoxT<DIM> &trackBox, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
     // By construction, current can't be null
     //assert(current != 0);
@@ -279,7 +319,7 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
         }
 
         if (isInside)
-            closestNeighbour->push_back(current->info);
+            recHits.push_back(current->info);
     }
     else
     {
@@ -298,11 +338,11 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
 
         if (isFullyContained)
         {
-            this->addSubtree(current->left);
+            this->addSubtree(current->left, recHits);
         }
         else if (hasIntersection)
         {
-            this->recSearch(current->left, trackBox);
+            this->recSearch(current->left, trackBox, recHits);
         }
 
         //if region( v->right ) is fully contained in the rectangle
@@ -319,11 +359,43 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
 
         if (isFullyContained)
         {
-            this->addSubtree(current->right);
+            this->addSubtree(current->right, recHits);
         }
         else if (hasIntersection)
         {
-            this->recSearch(current->right, trackBox);
+            this->recSearch(current->right, trackBox, recHits);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::recSearchRadius(const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point,
+    const float radius2, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
+{
+    if ((current->left == nullptr) && (current->right == nullptr))
+    {
+        // Leaf case
+        if (this->dist2(point, current->info) <= radius2)
+            recHits.push_back(current->info);
+    }
+    else
+    {
+        // Node case, considering sons in the same order as recSearch
+        for (const KDTreeNodeT<DATA, DIM> *const son : {current->left, current->right})
+        {
+            float minDist2(0.f), maxDist2(0.f);
+            this->regionDist2(point, son->region, minDist2, maxDist2);
+
+            if (maxDist2 <= radius2)
+            {
+                this->addSubtree(son, recHits);
+            }
+            else if (minDist2 <= radius2)
+            {
+                this->recSearchRadius(son, point, radius2, recHits);
+            }
         }
     }
 }
@@ -332,7 +404,7 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recSearch(const KDTreeNodeT<DATA, DIM>
 
 template <typename DATA, unsigned DIM>
 inline void KDTreeLinkerAlgo<DATA, DIM>::findNearestNeighbour(
-    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance)
+    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance) const
 {
     if (nullptr != result || distance != std::numeric_limits<float>::max())
     {
@@ -357,7 +429,7 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::findNearestNeighbour(
 
 template <typename DATA, unsigned DIM>
 inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(unsigned int depth, const KDTreeNodeT<DATA, DIM> *current,
-    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeT<DATA, DIM> *&best_match, float &best_dist)
+    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeT<DATA, DIM> *&best_match, float &best_dist) const
 {
     const unsigned int current_dim = depth % DIM;
 
@@ -418,7 +490,7 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(unsigned int depth,
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(const KDTreeNodeT<DATA, DIM> *current)
+inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(const KDTreeNodeT<DATA, DIM> *current, std::vector<KDTreeNodeInfoT<DATA, DIM>> &recHits) const
 {
     // By construction, current can't be null
     //assert(current != 0);
@@ -426,13 +498,13 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(const KDTreeNodeT<DATA, DIM>
     if ((current->left == nullptr) && (current->right == nullptr))
     {
         // Leaf case
-        closestNeighbour->push_back(current->info);
+        recHits.push_back(current->info);
     }
     else
     {
         // Node case
-        this->addSubtree(current->left);
-        this->addSubtree(current->right);
+        this->addSubtree(current->left, recHits);
+        this->addSubtree(current->right, recHits);
     }
 }
 
@@ -454,6 +526,28 @@ inline float KDTreeLinkerAlgo<DATA, DIM>::dist2(const KDTreeNodeInfoT<DATA, DIM>
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::regionDist2(
+    const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeBoxT<DIM> &region, float &minDist2, float &maxDist2) const
+{
+    double dmin = 0., dmax = 0.;
+
+    for (unsigned i = 0; i < DIM; ++i)
+    {
+        const double below = region.dimmin[i] - point.dims[i];
+        const double above = point.dims[i] - region.dimmax[i];
+        const double outside = std::max(0., std::max(below, above));
+        const double furthest = std::max(std::fabs(below), std::fabs(above));
+        dmin += outside * outside;
+        dmax += furthest * furthest;
+    }
+
+    minDist2 = (float)dmin;
+    maxDist2 = (float)dmax;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename DATA, unsigned DIM>
 inline void KDTreeLinkerAlgo<DATA, DIM>::clearTree()
 {
@@ -467,7 +561,7 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::clearTree()
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline bool KDTreeLinkerAlgo<DATA, DIM>::empty()
+inline bool KDTreeLinkerAlgo<DATA, DIM>::empty() const
 {
     return (nodePoolPos_ == -1);
 }
@@ -475,7 +569,7 @@ inline bool KDTreeLinkerAlgo<DATA, DIM>::empty()
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline int KDTreeLinkerAlgo<DATA, DIM>::size()
+inline int KDTreeLinkerAlgo<DATA, DIM>::size() const
 {
     return (nodePoolPos_ + 1);
 }
@@ -506,7 +600,8 @@ inline KDTreeNodeT<DATA, DIM> *KDTreeLinkerAlgo<DATA, DIM>::getNextNode()
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 template <typename DATA, unsigned DIM>
-inline KDTreeNodeT<DATA, DIM> *KDTreeLinkerAlgo<DATA, DIM>::recBuild(int low, int high, int depth, const KDTreeBoxT<DIM> &region)
+inline KDTreeNodeT<DATA, DIM> *KDTreeLinkerAlgo<DATA, DIM>::recBuild(
+    std::vector<KDTreeNodeInfoT<DATA, DIM>> &eltList, int low, int high, int depth, const KDTreeBoxT<DIM> &region)
 {
     const int portionSize = high - low;
 
@@ -517,25 +612,25 @@ inline KDTreeNodeT<DATA, DIM> *KDTreeLinkerAlgo<DATA, DIM>::recBuild(int low, in
     {
         // Leaf case
         KDTreeNodeT<DATA, DIM> *leaf = this->getNextNode();
-        leaf->setAttributs(region, (*initialEltList)[low]);
+        leaf->setAttributs(region, eltList[low]);
         return leaf;
     }
     else
     {
         // The even depth is associated to dim1 dimension, the odd one to dim2 dimension
-        int medianId = this->medianSearch(low, high, depth);
+        int medianId = this->medianSearch(eltList, low, high, depth);
 
         // We create the node
         KDTreeNodeT<DATA, DIM> *node = this->getNextNode();
         node->setAttributs(region);
-        node->info = (*initialEltList)[medianId];
+        node->info = eltList[medianId];
 
         // Here we split into 2 halfplanes the current plane
         KDTreeBoxT<DIM> leftRegion = region;
         KDTreeBoxT<DIM> rightRegion = region;
 
         const unsigned thedim = depth % DIM;
-        auto medianVal = (*initialEltList)[medianId].dims[thedim];
+        auto medianVal = eltList[medianId].dims[thedim];
         leftRegion.dimmax[thedim] = medianVal;
         rightRegion.dimmin[thedim] = medianVal;
 
@@ -543,8 +638,8 @@ inline KDTreeNodeT<DATA, DIM> *KDTreeLinkerAlgo<DATA, DIM>::recBuild(int low, in
         ++medianId;
 
         // We recursively build the son nodes
-        node->left = this->recBuild(low, medianId, depth, leftRegion);
-        node->right = this->recBuild(medianId, high, depth, rightRegion);
+        node->left = this->recBuild(eltList, low, medianId, depth, leftRegion);
+        node->right = this->recBuild(eltList, medianId, high, depth, rightRegion);
         return node;
     }
 }
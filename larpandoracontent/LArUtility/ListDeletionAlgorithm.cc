@@ -8,6 +8,8 @@
 
 #include "Pandora/AlgorithmHeaders.h"
 
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
+
 #include "larpandoracontent/LArUtility/ListDeletionAlgorithm.h"
 
 using namespace pandora;
@@ -37,6 +39,7 @@ StatusCode ListDeletionAlgorithm::Run()
         if (pList && !pList->empty())
         {
             const ClusterList listCopy(*pList);
+            LArSlidingFitCacheHelper::InvalidateClusters(this->GetPandora(), listCopy);
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Delete(*this, &listCopy, listName));
         }
     }
@@ -8,6 +8,8 @@
 
 #include "Pandora/AlgorithmHeaders.h"
 
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
+
 #include "larpandoracontent/LArUtility/ListPruningAlgorithm.h"
 
 using namespace pandora;
@@ -65,6 +67,8 @@ StatusCode ListPruningAlgorithm::Run()
                 if (!m_warnIfObjectsUnavailable && !pCluster->IsAvailable())
                     continue;
 
+                LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pCluster);
+
                 if (STATUS_CODE_SUCCESS != PandoraContentApi::Delete(*this, pCluster, listName) && m_warnIfObjectsUnavailable)
                     std::cout << "ListPruningAlgorithm: Could not delete Cluster." << std::endl;
             }
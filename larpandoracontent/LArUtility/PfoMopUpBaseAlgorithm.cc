@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArSlidingFitCacheHelper.h"
 
 #include "larpandoracontent/LArUtility/PfoMopUpBaseAlgorithm.h"
 
@@ -45,6 +46,8 @@ void PfoMopUpBaseAlgorithm::MergeAndDeletePfos(const ParticleFlowObject *const p
 
         if (pParentCluster)
         {
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pParentCluster);
+            LArSlidingFitCacheHelper::InvalidateCluster(this->GetPandora(), pDaughterCluster);
             PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=,
                 PandoraContentApi::MergeAndDeleteClusters(
                     *this, pParentCluster, pDaughterCluster, this->GetListName(pParentCluster), this->GetListName(pDaughterCluster)));
@@ -29,6 +29,7 @@ public:
     CandidateVertexCreationAlgorithm();
 
 private:
+    pandora::StatusCode Reset();
     pandora::StatusCode Run();
 
     /**
@@ -133,7 +134,7 @@ private:
     bool m_replaceCurrentVertexList;               ///< Whether to replace the current vertex list with the output list
 
     unsigned int m_slidingFitWindow;               ///< The layer window for the sliding linear fits
-    TwoDSlidingFitResultMap m_slidingFitResultMap; ///< The sliding fit result map
+    TwoDSlidingFitResultPtrMap m_slidingFitResultMap; ///< The sliding fit result map
 
     unsigned int m_minClusterCaloHits; ///< The min number of hits in base cluster selection method
     float m_minClusterLengthSquared;   ///< The min length (squared) in base cluster selection method
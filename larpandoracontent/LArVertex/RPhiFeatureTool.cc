@@ -164,7 +164,7 @@ float RPhiFeatureTool::GetFullScore(const KernelEstimate &kernelEstimateU, const
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void RPhiFeatureTool::FillKernelEstimate(const Vertex *const pVertex, const HitType hitType,
-    VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, KernelEstimate &kernelEstimate) const
+    const VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, KernelEstimate &kernelEstimate) const
 {
     const CartesianVector vertexPosition2D(LArGeometryHelper::ProjectPosition(this->GetPandora(), pVertex->GetPosition(), hitType));
     KDTreeBox searchRegionHits = build_2d_kd_search_region(vertexPosition2D, m_maxHitVertexDisplacement1D, m_maxHitVertexDisplacement1D);
@@ -140,7 +140,7 @@ private:
      *  @param  kernelEstimate to receive the populated kernel estimate
      */
     void FillKernelEstimate(const pandora::Vertex *const pVertex, const pandora::HitType hitType,
-        VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, KernelEstimate &kernelEstimate) const;
+        const VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, KernelEstimate &kernelEstimate) const;
 
     /**
      *  @brief  Whether to accept a candidate vertex, based on its spatial position in relation to other selected candidates
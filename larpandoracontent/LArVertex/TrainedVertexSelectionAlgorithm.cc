@@ -199,7 +199,7 @@ bool TrainedVertexSelectionAlgorithm::AddClusterToShower(const ClusterEndPointsM
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-bool TrainedVertexSelectionAlgorithm::AddClusterToShower(HitKDTree2D &kdTree, const HitToClusterMap &hitToClusterMap,
+bool TrainedVertexSelectionAlgorithm::AddClusterToShower(const HitKDTree2D &kdTree, const HitToClusterMap &hitToClusterMap,
     ClusterList &availableShowerLikeClusters, const Cluster *const pCluster, ClusterList &showerCluster) const
 {
     ClusterSet nearbyClusters;
@@ -565,14 +565,14 @@ const pandora::Vertex *TrainedVertexSelectionAlgorithm::ProduceTrainingExamples(
         {
             if (coinFlip(generator))
             {
-                LArMvaHelper::ProduceTrainingExample(
-                    trainingOutputFile + "_" + interactionType + ".txt", true, eventFeatureList, bestVertexFeatureList, featureList);
+                LArMvaHelper::ProduceTrainingExample(*m_pTrainingWriter, trainingOutputFile + "_" + interactionType + ".txt", true,
+                    eventFeatureList, bestVertexFeatureList, featureList);
             }
 
             else
             {
-                LArMvaHelper::ProduceTrainingExample(
-                    trainingOutputFile + "_" + interactionType + ".txt", false, eventFeatureList, featureList, bestVertexFeatureList);
+                LArMvaHelper::ProduceTrainingExample(*m_pTrainingWriter, trainingOutputFile + "_" + interactionType + ".txt", false,
+                    eventFeatureList, featureList, bestVertexFeatureList);
             }
         }
     }
@@ -690,6 +690,11 @@ StatusCode TrainedVertexSelectionAlgorithm::ReadSettings(const TiXmlHandle xmlHa
         return STATUS_CODE_INVALID_PARAMETER;
     }
 
+    if (m_trainingSetMode)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, MvaTrainingWriter::Create(xmlHandle, m_pTrainingWriter));
+    }
+
     PANDORA_RETURN_RESULT_IF_AND_IF(
         STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "MCParticleListName", m_mcParticleListName));
 
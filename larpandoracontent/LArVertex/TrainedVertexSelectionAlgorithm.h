@@ -11,6 +11,7 @@
 #include "Api/PandoraContentApi.h"
 
 #include "larpandoracontent/LArObjects/LArAdaBoostDecisionTree.h"
+#include "larpandoracontent/LArObjects/LArMvaTrainingWriter.h"
 #include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
@@ -179,7 +180,7 @@ protected:
      *
      *  @return boolean
      */
-    bool AddClusterToShower(HitKDTree2D &kdTree, const HitToClusterMap &hitToClusterMap, pandora::ClusterList &availableShowerLikeClusters,
+    bool AddClusterToShower(const HitKDTree2D &kdTree, const HitToClusterMap &hitToClusterMap, pandora::ClusterList &availableShowerLikeClusters,
         const pandora::Cluster *const pCluster, pandora::ClusterList &showerCluster) const;
 
     /**
@@ -368,6 +369,7 @@ protected:
     float m_mcVertexXCorrection;                              ///< The correction to the x-coordinate of the MC vertex position
     std::string m_trainingOutputFileRegion;                   ///< The training output file for the region mva
     std::string m_trainingOutputFileVertex;                   ///< The training output file for the vertex mva
+    std::unique_ptr<MvaTrainingWriter> m_pTrainingWriter;     ///< The writer for training examples, keeping the output files open
     std::string m_mcParticleListName;                         ///< The MC particle list for creating training examples
     std::string m_caloHitListName;                            ///< The 2D CaloHit list name
 
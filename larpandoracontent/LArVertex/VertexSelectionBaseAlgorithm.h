@@ -329,7 +329,7 @@ private:
      *
      *  @return boolean
      */
-    bool IsVertexOnHit(const pandora::Vertex *const pVertex, const pandora::HitType hitType, HitKDTree2D &kdTree) const;
+    bool IsVertexOnHit(const pandora::Vertex *const pVertex, const pandora::HitType hitType, const HitKDTree2D &kdTree) const;
 
     /**
      *  @brief  Whether the vertex lies in a registered gap
@@ -43,4 +43,42 @@ void LArDLHelper::Forward(TorchModel &model, const TorchInputVector &input, Torc
     output = model.forward(input).toTensor();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArDLHelper::SetNumThreads(const int nIntraOpThreads, const int nInterOpThreads)
+{
+    if (nIntraOpThreads > 0)
+        at::set_num_threads(nIntraOpThreads);
+
+    if ((nInterOpThreads > 0) && (nInterOpThreads != at::get_num_interop_threads()))
+    {
+        try
+        {
+            at::set_num_interop_threads(nInterOpThreads);
+        }
+        catch (...)
+        {
+            std::cout << "LArDLHelper::SetNumThreads - unable to set the number of inter-op threads, already in use with "
+                      << at::get_num_interop_threads() << " threads" << std::endl;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArDLHelper::WarmUp(TorchModel &model, const at::IntArrayRef dimensions, const unsigned int nPasses)
+{
+    TorchInput input;
+    LArDLHelper::InitialiseInput(dimensions, input);
+
+    TorchInputVector inputs;
+    inputs.push_back(input);
+
+    for (unsigned int iPass = 0; iPass < nPasses; ++iPass)
+    {
+        TorchOutput output;
+        LArDLHelper::Forward(model, inputs, output);
+    }
+}
+
 } // namespace lar_dl_content
@@ -53,6 +53,25 @@ public:
      *  @param  output the tensor to store the output in
      */
     static void Forward(TorchModel &model, const TorchInputVector &input, TorchOutput &output);
+
+    /**
+     *  @brief  Configure the LibTorch thread pools. These are shared by all models in the process, and the inter-op pool can only be
+     *          sized before its first use, so later requests to resize it are reported and ignored.
+     *
+     *  @param  nIntraOpThreads the number of threads used within each operation (values less than one leave the setting unchanged)
+     *  @param  nInterOpThreads the number of threads used across operations (values less than one leave the setting unchanged)
+     */
+    static void SetNumThreads(const int nIntraOpThreads, const int nInterOpThreads);
+
+    /**
+     *  @brief  Warm up a deep learning model by running blank inputs through it, so that the optimisation performed by the TorchScript
+     *          executor during the first calls to the model is not paid for when processing the first event
+     *
+     *  @param  model the model to warm up
+     *  @param  dimensions the size of each dimension of the blank input tensor: pass as {a, b, c, d} for example
+     *  @param  nPasses the number of passes of the blank input through the model
+     */
+    static void WarmUp(TorchModel &model, const at::IntArrayRef dimensions, const unsigned int nPasses);
 };
 
 } // namespace lar_dl_content
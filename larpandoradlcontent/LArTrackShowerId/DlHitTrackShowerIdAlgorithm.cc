@@ -18,6 +18,7 @@
 #include "larpandoracontent/LArHelpers/LArMonitoringHelper.h"
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArHelpers/LArThreadHelper.h"
 
 #include "larpandoracontent/LArObjects/LArCaloHit.h"
 
@@ -33,6 +34,11 @@ DlHitTrackShowerIdAlgorithm::DlHitTrackShowerIdAlgorithm() :
     m_imageHeight(256),
     m_imageWidth(256),
     m_tileSize(128.f),
+    m_batchSize(1),
+    m_nIntraOpThreads(0),
+    m_nInterOpThreads(0),
+    m_concurrentViewInference(false),
+    m_nWarmUpPasses(0),
     m_visualize(false),
     m_useTrainingMode(false),
     m_trainingOutputFile("")
@@ -47,6 +53,26 @@ DlHitTrackShowerIdAlgorithm::~DlHitTrackShowerIdAlgorithm()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode DlHitTrackShowerIdAlgorithm::Initialize()
+{
+    if (m_useTrainingMode)
+        return STATUS_CODE_SUCCESS;
+
+    LArDLHelper::SetNumThreads(m_nIntraOpThreads, m_nInterOpThreads);
+
+    // ATTN The first passes through a TorchScript model trigger its profiling and optimisation, so do this up front with a blank batch
+    if (m_nWarmUpPasses > 0)
+    {
+        LArDLHelper::WarmUp(m_modelU, {m_batchSize, 1, m_imageHeight, m_imageWidth}, m_nWarmUpPasses);
+        LArDLHelper::WarmUp(m_modelV, {m_batchSize, 1, m_imageHeight, m_imageWidth}, m_nWarmUpPasses);
+        LArDLHelper::WarmUp(m_modelW, {m_batchSize, 1, m_imageHeight, m_imageWidth}, m_nWarmUpPasses);
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode DlHitTrackShowerIdAlgorithm::Run()
 {
     if (m_useTrainingMode)
@@ -138,168 +164,84 @@ StatusCode DlHitTrackShowerIdAlgorithm::Train()
 
 StatusCode DlHitTrackShowerIdAlgorithm::Infer()
 {
-    const float eps{1.1920929e-7}; // Python float epsilon, used in image padding
-
     if (m_visualize)
     {
         PANDORA_MONITORING_API(SetEveDisplayParameters(this->GetPandora(), true, DETECTOR_VIEW_XZ, -1.f, 1.f, 1.f));
     }
 
+    // ATTN: Lists preceding an unavailable or invalid list are still processed, before the failure is reported
+    StatusCode listStatusCode(STATUS_CODE_SUCCESS);
+    StringVector listNames;
+    std::vector<const CaloHitList *> caloHitLists;
+
     for (const std::string listName : m_caloHitListNames)
     {
         const CaloHitList *pCaloHitList(nullptr);
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, listName, pCaloHitList));
+        listStatusCode = PandoraContentApi::GetList(*this, listName, pCaloHitList);
+
+        if (STATUS_CODE_SUCCESS != listStatusCode)
+            break;
 
         const HitType view{pCaloHitList->front()->GetHitType()};
 
         if (!(view == TPC_VIEW_U || view == TPC_VIEW_V || view == TPC_VIEW_W))
-            return STATUS_CODE_NOT_ALLOWED;
+        {
+            listStatusCode = STATUS_CODE_NOT_ALLOWED;
+            break;
+        }
 
-        LArDLHelper::TorchModel &model{view == TPC_VIEW_U ? m_modelU : (view == TPC_VIEW_V ? m_modelV : m_modelW)};
+        listNames.push_back(listName);
+        caloHitLists.push_back(pCaloHitList);
+    }
 
-        // Get bounds of hit region
-        float xMin{};
-        float xMax{};
-        float zMin{};
-        float zMax{};
-        this->GetHitRegion(*pCaloHitList, xMin, xMax, zMin, zMax);
-        const float xRange = (xMax + eps) - (xMin - eps);
-        int nTilesX = static_cast<int>(std::ceil(xRange / m_tileSize));
+    // Run the network for each view, concurrently if requested, with the hits only updated once all views have been processed
+    std::vector<TrackShowerIdResultVector> trackShowerIdResultsList(caloHitLists.size());
+    const unsigned int nThreads(m_concurrentViewInference ? caloHitLists.size() : 1);
 
-        PixelToTileMap sparseMap;
-        this->GetSparseTileMap(*pCaloHitList, xMin, zMin, nTilesX, sparseMap);
-        const int nTiles = sparseMap.size();
+    LArThreadHelper::ParallelFor(caloHitLists.size(), nThreads, [&](const unsigned int index) {
+        const HitType view{caloHitLists.at(index)->front()->GetHitType()};
+        LArDLHelper::TorchModel &model{view == TPC_VIEW_U ? m_modelU : (view == TPC_VIEW_V ? m_modelV : m_modelW)};
+        this->InferHits(model, *caloHitLists.at(index), trackShowerIdResultsList.at(index));
+    });
 
+    for (unsigned int index = 0; index < caloHitLists.size(); ++index)
+    {
         CaloHitList trackHits, showerHits, otherHits;
-        // Process tile
-        // ATTN: Be sure to reset all values to zero after each tile has been processed
-        float **weights = new float *[m_imageHeight];
-        for (int r = 0; r < m_imageHeight; ++r)
-            weights[r] = new float[m_imageWidth]();
-        for (int i = 0; i < nTiles; ++i)
-        {
-            for (const CaloHit *pCaloHit : *pCaloHitList)
-            {
-                const float x(pCaloHit->GetPositionVector().GetX());
-                const float z(pCaloHit->GetPositionVector().GetZ());
-                // Determine which tile the hit will be assigned to
-                const int tileX = static_cast<int>(std::floor((x - xMin) / m_tileSize));
-                const int tileZ = static_cast<int>(std::floor((z - zMin) / m_tileSize));
-                const int tile = sparseMap.at(tileZ * nTilesX + tileX);
-                if (tile == i)
-                {
-                    // Determine hit position within the tile
-                    const float localX = std::fmod(x - xMin, m_tileSize);
-                    const float localZ = std::fmod(z - zMin, m_tileSize);
-                    // Determine hit pixel within the tile
-                    const int pixelX = static_cast<int>(std::floor(localX * m_imageWidth / m_tileSize));
-                    const int pixelZ = (m_imageHeight - 1) - static_cast<int>(std::floor(localZ * m_imageHeight / m_tileSize));
-                    weights[pixelZ][pixelX] += pCaloHit->GetInputEnergy();
-                }
-            }
 
-            // Find min and max charge to allow normalisation
-            float chargeMin{std::numeric_limits<float>::max()}, chargeMax{-std::numeric_limits<float>::max()};
-            for (int r = 0; r < m_imageHeight; ++r)
-            {
-                for (int c = 0; c < m_imageWidth; ++c)
-                {
-                    if (weights[r][c] > chargeMax)
-                        chargeMax = weights[r][c];
-                    if (weights[r][c] < chargeMin)
-                        chargeMin = weights[r][c];
-                }
-            }
-            float chargeRange{chargeMax - chargeMin};
-            if (chargeRange <= 0.f)
-                chargeRange = 1.f;
-
-            // Populate accessor based on normalised weights
-            CaloHitToPixelMap caloHitToPixelMap;
-            LArDLHelper::TorchInput input;
-            LArDLHelper::InitialiseInput({1, 1, m_imageHeight, m_imageWidth}, input);
-            auto accessor = input.accessor<float, 4>();
-            for (const CaloHit *pCaloHit : *pCaloHitList)
-            {
-                const float x(pCaloHit->GetPositionVector().GetX());
-                const float z(pCaloHit->GetPositionVector().GetZ());
-                // Determine which tile the hit will be assigned to
-                const int tileX = static_cast<int>(std::floor((x - xMin) / m_tileSize));
-                const int tileZ = static_cast<int>(std::floor((z - zMin) / m_tileSize));
-                const int tile = sparseMap.at(tileZ * nTilesX + tileX);
-                if (tile == i)
-                {
-                    // Determine hit position within the tile
-                    const float localX = std::fmod(x - xMin, m_tileSize);
-                    const float localZ = std::fmod(z - zMin, m_tileSize);
-                    // Determine hit pixel within the tile
-                    const int pixelX = static_cast<int>(std::floor(localX * m_imageWidth / m_tileSize));
-                    const int pixelZ = (m_imageHeight - 1) - static_cast<int>(std::floor(localZ * m_imageHeight / m_tileSize));
-                    accessor[0][0][pixelZ][pixelX] = (weights[pixelZ][pixelX] - chargeMin) / chargeRange;
-                    caloHitToPixelMap.insert(std::make_pair(pCaloHit, std::make_tuple(tileZ, tileX, pixelZ, pixelX)));
-                }
-            }
-            // Reset weights
-            for (int r = 0; r < this->m_imageHeight; ++r)
-                for (int c = 0; c < this->m_imageWidth; ++c)
-                    weights[r][c] = 0.f;
-
-            // Run the input through the trained model and get the output accessor
-            LArDLHelper::TorchInputVector inputs;
-            inputs.push_back(input);
-            LArDLHelper::TorchOutput output;
-            LArDLHelper::Forward(model, inputs, output);
-            auto outputAccessor = output.accessor<float, 4>();
-
-            for (const CaloHit *pCaloHit : *pCaloHitList)
-            {
-                auto found{caloHitToPixelMap.find(pCaloHit)};
-                if (found == caloHitToPixelMap.end())
-                    continue;
-                auto pixelMap = found->second;
-                const int tileZ(std::get<0>(pixelMap));
-                const int tileX(std::get<1>(pixelMap));
-                const int tile = sparseMap.at(tileZ * nTilesX + tileX);
-                if (tile == i)
-                { // Make sure we're looking at a hit in the correct tile
-                    const int pixelZ(std::get<2>(pixelMap));
-                    const int pixelX(std::get<3>(pixelMap));
-
-                    // Apply softmax to loss to get actual probability
-                    float probShower = exp(outputAccessor[0][1][pixelZ][pixelX]);
-                    float probTrack = exp(outputAccessor[0][2][pixelZ][pixelX]);
-                    float probNull = exp(outputAccessor[0][0][pixelZ][pixelX]);
-                    if (probShower > probTrack && probShower > probNull)
-                        showerHits.push_back(pCaloHit);
-                    else if (probTrack > probShower && probTrack > probNull)
-                        trackHits.push_back(pCaloHit);
-                    else
-                        otherHits.push_back(pCaloHit);
-                    float recipSum = 1.f / (probShower + probTrack);
-                    // Adjust probabilities to ignore null hits and update LArCaloHit
-                    probShower *= recipSum;
-                    probTrack *= recipSum;
-                    LArCaloHit *pLArCaloHit{const_cast<LArCaloHit *>(dynamic_cast<const LArCaloHit *>(pCaloHit))};
-                    pLArCaloHit->SetShowerProbability(probShower);
-                    pLArCaloHit->SetTrackProbability(probTrack);
-                }
-            }
+        for (const TrackShowerIdResult &result : trackShowerIdResultsList.at(index))
+        {
+            const CaloHit *const pCaloHit{result.m_pCaloHit};
+            float probShower{result.m_probShower};
+            float probTrack{result.m_probTrack};
+            const float probNull{result.m_probNull};
+            if (probShower > probTrack && probShower > probNull)
+                showerHits.push_back(pCaloHit);
+            else if (probTrack > probShower && probTrack > probNull)
+                trackHits.push_back(pCaloHit);
+            else
+                otherHits.push_back(pCaloHit);
+            float recipSum = 1.f / (probShower + probTrack);
+            // Adjust probabilities to ignore null hits and update LArCaloHit
+            probShower *= recipSum;
+            probTrack *= recipSum;
+            LArCaloHit *pLArCaloHit{const_cast<LArCaloHit *>(dynamic_cast<const LArCaloHit *>(pCaloHit))};
+            pLArCaloHit->SetShowerProbability(probShower);
+            pLArCaloHit->SetTrackProbability(probTrack);
         }
-        for (int r = 0; r < this->m_imageHeight; ++r)
-            delete[] weights[r];
-        delete[] weights;
 
         if (m_visualize)
         {
-            const std::string trackListName("TrackHits_" + listName);
-            const std::string showerListName("ShowerHits_" + listName);
-            const std::string otherListName("OtherHits_" + listName);
+            const std::string trackListName("TrackHits_" + listNames.at(index));
+            const std::string showerListName("ShowerHits_" + listNames.at(index));
+            const std::string otherListName("OtherHits_" + listNames.at(index));
             PANDORA_MONITORING_API(VisualizeCaloHits(this->GetPandora(), &trackHits, trackListName, BLUE));
             PANDORA_MONITORING_API(VisualizeCaloHits(this->GetPandora(), &showerHits, showerListName, RED));
             PANDORA_MONITORING_API(VisualizeCaloHits(this->GetPandora(), &otherHits, otherListName, BLACK));
         }
     }
 
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, listStatusCode);
+
     if (m_visualize)
     {
         PANDORA_MONITORING_API(ViewEvent(this->GetPandora()));
@@ -310,7 +252,38 @@ StatusCode DlHitTrackShowerIdAlgorithm::Infer()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void DlHitTrackShowerIdAlgorithm::GetHitRegion(const CaloHitList &caloHitList, float &xMin, float &xMax, float &zMin, float &zMax)
+void DlHitTrackShowerIdAlgorithm::InferHits(
+    LArDLHelper::TorchModel &model, const CaloHitList &caloHitList, TrackShowerIdResultVector &trackShowerIdResults) const
+{
+    const float eps{1.1920929e-7}; // Python float epsilon, used in image padding
+
+    // Get bounds of hit region
+    float xMin{};
+    float xMax{};
+    float zMin{};
+    float zMax{};
+    this->GetHitRegion(caloHitList, xMin, xMax, zMin, zMax);
+    const float xRange = (xMax + eps) - (xMin - eps);
+    int nTilesX = static_cast<int>(std::ceil(xRange / m_tileSize));
+
+    PixelToTileMap sparseMap;
+    this->GetSparseTileMap(caloHitList, xMin, zMin, nTilesX, sparseMap);
+    const int nTiles = sparseMap.size();
+
+    TiledHitVectorList tiledHitVectorList(nTiles);
+    this->GetTiledHits(caloHitList, xMin, zMin, nTilesX, sparseMap, tiledHitVectorList);
+
+    trackShowerIdResults.reserve(caloHitList.size());
+    for (int firstTile = 0; firstTile < nTiles; firstTile += m_batchSize)
+    {
+        const int nBatchTiles(std::min(m_batchSize, nTiles - firstTile));
+        this->InferTileBatch(model, tiledHitVectorList, firstTile, nBatchTiles, trackShowerIdResults);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DlHitTrackShowerIdAlgorithm::GetHitRegion(const CaloHitList &caloHitList, float &xMin, float &xMax, float &zMin, float &zMax) const
 {
     xMin = std::numeric_limits<float>::max();
     xMax = -std::numeric_limits<float>::max();
@@ -334,7 +307,7 @@ void DlHitTrackShowerIdAlgorithm::GetHitRegion(const CaloHitList &caloHitList, f
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void DlHitTrackShowerIdAlgorithm::GetSparseTileMap(
-    const CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX, PixelToTileMap &sparseMap)
+    const CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX, PixelToTileMap &sparseMap) const
 {
     // Identify the tiles that actually contain hits
     std::map<int, bool> tilePopulationMap;
@@ -362,6 +335,141 @@ void DlHitTrackShowerIdAlgorithm::GetSparseTileMap(
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void DlHitTrackShowerIdAlgorithm::GetTiledHits(const CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX,
+    const PixelToTileMap &sparseMap, TiledHitVectorList &tiledHitVectorList) const
+{
+    for (const CaloHit *pCaloHit : caloHitList)
+    {
+        const float x(pCaloHit->GetPositionVector().GetX());
+        const float z(pCaloHit->GetPositionVector().GetZ());
+        // Determine which tile the hit will be assigned to
+        const int tileX = static_cast<int>(std::floor((x - xMin) / m_tileSize));
+        const int tileZ = static_cast<int>(std::floor((z - zMin) / m_tileSize));
+        const int tile = sparseMap.at(tileZ * nTilesX + tileX);
+        // Determine hit position within the tile
+        const float localX = std::fmod(x - xMin, m_tileSize);
+        const float localZ = std::fmod(z - zMin, m_tileSize);
+        // Determine hit pixel within the tile
+        const int pixelX = static_cast<int>(std::floor(localX * m_imageWidth / m_tileSize));
+        const int pixelZ = (m_imageHeight - 1) - static_cast<int>(std::floor(localZ * m_imageHeight / m_tileSize));
+        tiledHitVectorList.at(tile).emplace_back(pCaloHit, pixelZ, pixelX);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void DlHitTrackShowerIdAlgorithm::InferTileBatch(LArDLHelper::TorchModel &model, const TiledHitVectorList &tiledHitVectorList,
+    const int firstTile, const int nBatchTiles, TrackShowerIdResultVector &trackShowerIdResults) const
+{
+    const int nPixels(m_imageHeight * m_imageWidth);
+    LArDLHelper::TorchInput input;
+    LArDLHelper::InitialiseInput({nBatchTiles, 1, m_imageHeight, m_imageWidth}, input);
+    auto accessor = input.accessor<float, 4>();
+
+    // ATTN: Only the pixels containing hits are filled, so only these need to be reset after each tile has been processed
+    std::vector<float> weights(nPixels, 0.f);
+    std::vector<bool> isOccupied(nPixels, false);
+
+    for (int b = 0; b < nBatchTiles; ++b)
+    {
+        const TiledHitVector &tiledHits(tiledHitVectorList.at(firstTile + b));
+        int nOccupiedPixels{0};
+
+        for (const TiledHit &tiledHit : tiledHits)
+        {
+            const int pixel{tiledHit.m_pixelZ * m_imageWidth + tiledHit.m_pixelX};
+            weights[pixel] += tiledHit.m_pCaloHit->GetInputEnergy();
+
+            if (!isOccupied[pixel])
+            {
+                isOccupied[pixel] = true;
+                ++nOccupiedPixels;
+            }
+        }
+
+        // Find min and max charge to allow normalisation, including the empty pixels of the tile
+        float chargeMin{std::numeric_limits<float>::max()}, chargeMax{-std::numeric_limits<float>::max()};
+        if (nOccupiedPixels < nPixels)
+        {
+            chargeMin = 0.f;
+            chargeMax = 0.f;
+        }
+        for (const TiledHit &tiledHit : tiledHits)
+        {
+            const float weight{weights[tiledHit.m_pixelZ * m_imageWidth + tiledHit.m_pixelX]};
+            if (weight > chargeMax)
+                chargeMax = weight;
+            if (weight < chargeMin)
+                chargeMin = weight;
+        }
+        float chargeRange{chargeMax - chargeMin};
+        if (chargeRange <= 0.f)
+            chargeRange = 1.f;
+
+        // Populate accessor based on normalised weights
+        for (const TiledHit &tiledHit : tiledHits)
+        {
+            const int pixel{tiledHit.m_pixelZ * m_imageWidth + tiledHit.m_pixelX};
+            accessor[b][0][tiledHit.m_pixelZ][tiledHit.m_pixelX] = (weights[pixel] - chargeMin) / chargeRange;
+        }
+
+        // Reset weights
+        for (const TiledHit &tiledHit : tiledHits)
+        {
+            const int pixel{tiledHit.m_pixelZ * m_imageWidth + tiledHit.m_pixelX};
+            weights[pixel] = 0.f;
+            isOccupied[pixel] = false;
+        }
+    }
+
+    // Run the input through the trained model and get the output accessor
+    LArDLHelper::TorchInputVector inputs;
+    inputs.push_back(input);
+    LArDLHelper::TorchOutput output;
+    LArDLHelper::Forward(model, inputs, output);
+    auto outputAccessor = output.accessor<float, 4>();
+
+    for (int b = 0; b < nBatchTiles; ++b)
+    {
+        for (const TiledHit &tiledHit : tiledHitVectorList.at(firstTile + b))
+        {
+            const int pixelZ(tiledHit.m_pixelZ);
+            const int pixelX(tiledHit.m_pixelX);
+
+            // Apply softmax to loss to get actual probability
+            const float probShower = exp(outputAccessor[b][1][pixelZ][pixelX]);
+            const float probTrack = exp(outputAccessor[b][2][pixelZ][pixelX]);
+            const float probNull = exp(outputAccessor[b][0][pixelZ][pixelX]);
+            trackShowerIdResults.emplace_back(tiledHit.m_pCaloHit, probShower, probTrack, probNull);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+DlHitTrackShowerIdAlgorithm::TiledHit::TiledHit(const CaloHit *const pCaloHit, const int pixelZ, const int pixelX) :
+    m_pCaloHit(pCaloHit),
+    m_pixelZ(pixelZ),
+    m_pixelX(pixelX)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+DlHitTrackShowerIdAlgorithm::TrackShowerIdResult::TrackShowerIdResult(
+    const CaloHit *const pCaloHit, const float probShower, const float probTrack, const float probNull) :
+    m_pCaloHit(pCaloHit),
+    m_probShower(probShower),
+    m_probTrack(probTrack),
+    m_probNull(probNull)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "UseTrainingMode", m_useTrainingMode));
@@ -393,6 +501,20 @@ StatusCode DlHitTrackShowerIdAlgorithm::ReadSettings(const TiXmlHandle xmlHandle
         std::cout << "Error: Invalid image size specification" << std::endl;
         return STATUS_CODE_INVALID_PARAMETER;
     }
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "BatchSize", m_batchSize));
+    if (m_batchSize <= 0)
+    {
+        std::cout << "Error: Invalid batch size specification" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NumIntraOpThreads", m_nIntraOpThreads));
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NumInterOpThreads", m_nInterOpThreads));
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=,
+        XmlHelper::ReadValue(xmlHandle, "ConcurrentViewInference", m_concurrentViewInference));
+    PANDORA_RETURN_RESULT_IF_AND_IF(
+        STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "NumWarmUpPasses", m_nWarmUpPasses));
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle, "Visualize", m_visualize));
 
     return STATUS_CODE_SUCCESS;
@@ -29,9 +29,56 @@ public:
     virtual ~DlHitTrackShowerIdAlgorithm();
 
 private:
-    typedef std::map<const pandora::CaloHit *, std::tuple<int, int, int, int>> CaloHitToPixelMap;
     typedef std::map<int, int> PixelToTileMap;
 
+    /**
+     *  @brief  TiledHit class, describing the pixel within its tile to which a calo hit is assigned
+     */
+    class TiledHit
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCaloHit the address of the calo hit
+         *  @param  pixelZ the pixel row within the tile
+         *  @param  pixelX the pixel column within the tile
+         */
+        TiledHit(const pandora::CaloHit *const pCaloHit, const int pixelZ, const int pixelX);
+
+        const pandora::CaloHit *m_pCaloHit; ///< The address of the calo hit
+        int m_pixelZ;                       ///< The pixel row within the tile
+        int m_pixelX;                       ///< The pixel column within the tile
+    };
+
+    typedef std::vector<TiledHit> TiledHitVector;
+    typedef std::vector<TiledHitVector> TiledHitVectorList;
+
+    /**
+     *  @brief  TrackShowerIdResult class, holding the unnormalised network outputs for a calo hit
+     */
+    class TrackShowerIdResult
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCaloHit the address of the calo hit
+         *  @param  probShower the unnormalised shower probability
+         *  @param  probTrack the unnormalised track probability
+         *  @param  probNull the unnormalised null probability
+         */
+        TrackShowerIdResult(const pandora::CaloHit *const pCaloHit, const float probShower, const float probTrack, const float probNull);
+
+        const pandora::CaloHit *m_pCaloHit; ///< The address of the calo hit
+        float m_probShower;                 ///< The unnormalised shower probability
+        float m_probTrack;                  ///< The unnormalised track probability
+        float m_probNull;                   ///< The unnormalised null probability
+    };
+
+    typedef std::vector<TrackShowerIdResult> TrackShowerIdResultVector;
+
+    pandora::StatusCode Initialize();
     pandora::StatusCode Run();
 
     /**
@@ -45,6 +92,16 @@ private:
     pandora::StatusCode Infer();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    /**
+     *  @brief  Run network inference for the hits in a single view
+     *
+     *  @param  model The model to run
+     *  @param  caloHitList The list of CaloHits to classify
+     *  @param  trackShowerIdResults The output network results, grouped by tile
+     */
+    void InferHits(
+        LArDLHelper::TorchModel &model, const pandora::CaloHitList &caloHitList, TrackShowerIdResultVector &trackShowerIdResults) const;
+
     /**
      *  @brief  Identify the XZ range containing the hits for an event
      *
@@ -54,7 +111,7 @@ private:
      *  @param  zMin The output minimum z-coordinate
      *  @param  zMax The output maximum z-coordinate
      */
-    void GetHitRegion(const pandora::CaloHitList &caloHitList, float &xMin, float &xMax, float &zMin, float &zMax);
+    void GetHitRegion(const pandora::CaloHitList &caloHitList, float &xMin, float &xMax, float &zMin, float &zMax) const;
 
     /**
      *  @brief  Populate a map between pixels and tiles
@@ -65,7 +122,33 @@ private:
      *  @param  nTilesX The number of tiles in the x direction
      *  @param  sparseMap The output map between pixels and tiles
      */
-    void GetSparseTileMap(const pandora::CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX, PixelToTileMap &sparseMap);
+    void GetSparseTileMap(
+        const pandora::CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX, PixelToTileMap &sparseMap) const;
+
+    /**
+     *  @brief  Assign each calo hit to its pixel within its tile, in a single pass over the hits
+     *
+     *  @param  caloHitList The list of CaloHits to be assigned
+     *  @param  xMin The minimum x-coordinate
+     *  @param  zMin The minimum z-coordinate
+     *  @param  nTilesX The number of tiles in the x direction
+     *  @param  sparseMap The map between pixels and tiles
+     *  @param  tiledHitVectorList The output list of tiled hits for each tile, with hits in the order of the input list
+     */
+    void GetTiledHits(const pandora::CaloHitList &caloHitList, const float xMin, const float zMin, const int nTilesX,
+        const PixelToTileMap &sparseMap, TiledHitVectorList &tiledHitVectorList) const;
+
+    /**
+     *  @brief  Run network inference for a batch of tiles
+     *
+     *  @param  model The model to run
+     *  @param  tiledHitVectorList The list of tiled hits for each tile
+     *  @param  firstTile The index of the first tile in the batch
+     *  @param  nBatchTiles The number of tiles in the batch
+     *  @param  trackShowerIdResults To receive the network results for the hits in the batch
+     */
+    void InferTileBatch(LArDLHelper::TorchModel &model, const TiledHitVectorList &tiledHitVectorList, const int firstTile,
+        const int nBatchTiles, TrackShowerIdResultVector &trackShowerIdResults) const;
 
     pandora::StringVector m_caloHitListNames; ///< Name of input calo hit list
     std::string m_modelFileNameU;             ///< Model file name for U view
@@ -77,6 +160,11 @@ private:
     int m_imageHeight;                        ///< Height of images in pixels
     int m_imageWidth;                         ///< Width of images in pixels
     float m_tileSize;                         ///< Size of tile in cm
+    int m_batchSize;                          ///< Maximum number of tiles to pass through the network in a single batch
+    int m_nIntraOpThreads;                    ///< Number of threads used within each network operation (0 for the library default)
+    int m_nInterOpThreads;                    ///< Number of threads used across network operations (0 for the library default)
+    bool m_concurrentViewInference;           ///< Whether to run network inference for the different views concurrently
+    unsigned int m_nWarmUpPasses;             ///< Number of passes of a blank batch through each model at initialization
     bool m_visualize;                         ///< Whether to visualize the track shower ID scores
     bool m_useTrainingMode;                   ///< Training mode
     std::string m_trainingOutputFile;         ///< Output file name for training examples